@@ -0,0 +1,57 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ChainedTimebase.h"
+
+bool ChainedTimebase_IsConsistent(
+	const struct ChainedTimebase_Sample *const sample)
+{
+	return sample->epoch == sample->epoch_check &&
+	       sample->high == sample->high_check &&
+	       sample->middle == sample->middle_check &&
+	       (sample->low & CHAINED_TIMEBASE_CHANNEL_MASK) >=
+		       CHAINED_TIMEBASE_CARRY_GUARD_TICKS;
+}
+
+uint64_t
+ChainedTimebase_Compose(const struct ChainedTimebase_Sample *const sample)
+{
+	return ((uint64_t)sample->epoch
+		<< (3u * CHAINED_TIMEBASE_CHANNEL_BITS)) |
+	       ((uint64_t)(sample->high & CHAINED_TIMEBASE_CHANNEL_MASK)
+		<< (2u * CHAINED_TIMEBASE_CHANNEL_BITS)) |
+	       ((uint64_t)(sample->middle & CHAINED_TIMEBASE_CHANNEL_MASK)
+		<< CHAINED_TIMEBASE_CHANNEL_BITS) |
+	       (uint64_t)(sample->low & CHAINED_TIMEBASE_CHANNEL_MASK);
+}
+
+bool ChainedTimebase_TryRead(const ChainedTimebase_SampleReader read_sample,
+			     uint64_t *const ticks)
+{
+	for (uint32_t pass = 0u; pass < CHAINED_TIMEBASE_MAXIMUM_PASSES;
+	     pass++) {
+		struct ChainedTimebase_Sample sample;
+		read_sample(&sample);
+		if (ChainedTimebase_IsConsistent(&sample)) {
+			*ticks = ChainedTimebase_Compose(&sample);
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,101 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHAINEDTIMEBASE_H
+#define CHAINEDTIMEBASE_H
+
+/**
+ * @file    ChainedTimebase.h
+ * @brief   Consistency check and composition of reads of a timebase built
+ *          from three chained 16-bit counters and a software epoch.
+ *
+ * The upper channels are read before and after the lowest one. A read is
+ * consistent when both reads of each upper channel and of the epoch are
+ * equal, and the lowest channel is outside of the guard band after its
+ * wrap, in which the carry may not have propagated yet. The module does not
+ * access the hardware, the reads are done by the caller.
+ *
+ * A reader preempted for a whole period of the lowest channel on every pass
+ * never gets a consistent read, so the number of passes is bounded and the
+ * caller shall read again with interrupts disabled when the bound is hit.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CHAINED_TIMEBASE_CHANNEL_BITS 16u
+#define CHAINED_TIMEBASE_CHANNEL_MASK 0xFFFFu
+#define CHAINED_TIMEBASE_CARRY_GUARD_TICKS 2u
+#define CHAINED_TIMEBASE_MAXIMUM_PASSES 3u
+
+/**
+ * @brief   Struct representing a single read of the chained timebase, in
+ *          the order in which the values are read
+ */
+struct ChainedTimebase_Sample {
+	uint32_t epoch;
+	uint32_t high;
+	uint32_t middle;
+	uint32_t low;
+	uint32_t middle_check;
+	uint32_t high_check;
+	uint32_t epoch_check;
+};
+
+/**
+ * @brief   Function reading all values of the sample, in the declared order
+ */
+typedef void (*ChainedTimebase_SampleReader)(
+	struct ChainedTimebase_Sample *const sample);
+
+/**
+ * @brief                   Checks whether the sample can be composed into
+ *                          a timestamp
+ *
+ * @param[in] sample        sample read by the caller
+ *
+ * @return                  Bool indicating whether the sample is consistent
+ */
+bool ChainedTimebase_IsConsistent(
+	const struct ChainedTimebase_Sample *const sample);
+
+/**
+ * @brief                   Composes a consistent sample into ticks
+ *
+ * @param[in] sample        consistent sample
+ *
+ * @return                  Number of ticks represented by the sample
+ */
+uint64_t
+ChainedTimebase_Compose(const struct ChainedTimebase_Sample *const sample);
+
+/**
+ * @brief                   Reads the timebase, repeating inconsistent reads
+ *                          at most CHAINED_TIMEBASE_MAXIMUM_PASSES times
+ *
+ * @param[in] read_sample   function reading a sample of the timebase
+ * @param[out] ticks        number of ticks, set only on success
+ *
+ * @return                  Bool indicating whether a consistent sample was
+ *                          read
+ */
+bool ChainedTimebase_TryRead(const ChainedTimebase_SampleReader read_sample,
+			     uint64_t *const ticks);
+
+#endif
@@ -0,0 +1,42 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CycleCounter.h"
+
+void CycleCounter_Init(struct CycleCounter *const counter,
+		       const uint32_t raw_value)
+{
+	counter->extended_value = raw_value;
+}
+
+uint64_t CycleCounter_Extend(struct CycleCounter *const counter,
+			     const uint32_t raw_value)
+{
+	const uint32_t previous_raw_value = (uint32_t)counter->extended_value;
+	counter->extended_value +=
+		CycleCounter_Difference(previous_raw_value, raw_value);
+
+	return counter->extended_value;
+}
+
+uint32_t CycleCounter_Difference(const uint32_t start, const uint32_t end)
+{
+	// Unsigned arithmetic is modulo 2^32
+	return end - start;
+}
@@ -0,0 +1,73 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYCLECOUNTER_H
+#define CYCLECOUNTER_H
+
+/**
+ * @file    CycleCounter.h
+ * @brief   Extension of a wrapping 32-bit hardware counter to 64 bits.
+ *
+ * The extension is correct as long as it is sampled at least once per
+ * counter period (2^32 counts). The module does not access the hardware
+ * and does not synchronize concurrent callers, this is left to the user.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief   Struct representing a 32-bit counter extended to 64 bits
+ */
+struct CycleCounter {
+	uint64_t extended_value;
+};
+
+/**
+ * @brief                   Initializes the extended counter
+ *
+ * @param[out] counter      counter to initialize
+ * @param[in] raw_value     current value of the hardware counter
+ */
+void CycleCounter_Init(struct CycleCounter *const counter,
+		       const uint32_t raw_value);
+
+/**
+ * @brief                   Updates the extended counter with a new sample
+ *
+ * @param[in,out] counter   initialized counter
+ * @param[in] raw_value     current value of the hardware counter
+ *
+ * @return                  Extended 64-bit value of the counter
+ */
+uint64_t CycleCounter_Extend(struct CycleCounter *const counter,
+			     const uint32_t raw_value);
+
+/**
+ * @brief                   Returns number of counts between two samples,
+ *                          taking a single wraparound into account
+ *
+ * @param[in] start         earlier sample of the hardware counter
+ * @param[in] end           later sample of the hardware counter
+ *
+ * @return                  Number of counts between the samples
+ */
+uint32_t CycleCounter_Difference(const uint32_t start, const uint32_t end);
+
+#endif
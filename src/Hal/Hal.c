@@ -25,7 +25,6 @@
 #include <Nvic/Nvic.h>
 #include <Pmc/Pmc.h>
 #include <Tic/Tic.h>
-#include <Utils/ConcurrentAccessFlag.h>
 #include <interfaces_info.h>
 #include <rtems.h>
 
@@ -37,16 +36,102 @@
 #include <Wdt/Wdt.h>
 #include <SamV71Core.h>
 
-#define NANOSECOND_IN_SECOND 1000000000.0
-#define TICKS_PER_RELOAD 65535ul
-#define CLOCK_SELECTION_PRESCALLER 8.0
+#include "ChainedTimebase.h"
+#include "CycleCounter.h"
+#include "IdleAccounting.h"
+#include "MutexState.h"
+#include "TimeConversion.h"
+#include "TimebaseLatch.h"
+#include "TimerQueue.h"
+
+#define NANOSECONDS_IN_MICROSECOND 1000u
+#define CLOCK_SELECTION_PRESCALLER 8u
+
+#define TIMEBASE_CHANNEL_HALF_RANGE 0x8000u
+
+#define DEMCR_ADDRESS 0xE000EDFCu
+#define DEMCR_TRCENA_MASK (1u << 24)
+#define DWT_CTRL_ADDRESS 0xE0001000u
+#define DWT_CTRL_CYCCNTENA_MASK (1u << 0)
+#define DWT_CTRL_NOCYCCNT_MASK (1u << 25)
+#define DWT_CYCCNT_ADDRESS 0xE0001004u
+#define DWT_LAR_ADDRESS 0xE0001FB0u
+#define DWT_LAR_UNLOCK_KEY 0xC5ACCE55u
+#define CYCLE_COUNTER_PROBE_ITERATIONS 16u
+
+#define COMPARATOR_MAX_TICKS 0xFFFFu
+// Ratio between MCK/128 and MCK/8 clock selections
+#define COMPARATOR_COARSE_CLOCK_RATIO 16u
+
+// Handles carry a type tag in the upper half and the index of the slot
+// increased by one in the lower half, so that they are never 0
+#define HANDLE_INDEX_MASK 0x0000FFFFu
+#define SEMAPHORE_HANDLE_TAG 0x00530000u
+#define MUTEX_HANDLE_TAG 0x004D0000u
+#define TIMER_HANDLE_TAG 0x00540000u
+
+#ifndef RT_HAL_WATCHDOG_RESET_PERIOD_NS
+#define RT_HAL_WATCHDOG_RESET_PERIOD_NS 100000000ull
+#endif
+
+#ifndef RT_HAL_SLEEP_EVENT
+#define RT_HAL_SLEEP_EVENT RTEMS_EVENT_31
+#endif
 
 static uint32_t created_semaphores_count = 0;
-static rtems_id hal_semaphore_ids[RT_MAX_HAL_SEMAPHORES];
 
-static ConcurrentAccessFlag reloads_modified_flag;
-static uint32_t reloads_counter;
+struct Hal_Semaphore {
+	rtems_id id;
+	uint32_t acquisitions_count;
+	uint32_t contended_acquisitions_count;
+	uint64_t total_wait_ticks;
+	uint64_t maximum_wait_ticks;
+	uint64_t maximum_hold_ticks;
+	uint64_t obtain_ticks;
+	rtems_id holder;
+	uint32_t nesting_depth;
+};
+
+static struct Hal_Semaphore hal_semaphores[RT_MAX_HAL_SEMAPHORES];
+
+struct Hal_Mutex {
+	struct MutexState state;
+	rtems_id owner;
+	rtems_id semaphore_id;
+	enum Hal_MutexProtocol protocol;
+};
+
+static uint32_t created_mutexes_count = 0;
+static struct Hal_Mutex hal_mutexes[RT_MAX_HAL_MUTEXES];
+
+struct Hal_Timer {
+	struct TimerQueue_Entry entry;
+	Hal_TimerCallback callback;
+	void *arg;
+	bool is_armed;
+	uint64_t expiration_ns;
+	uint64_t period_ns;
+};
+
+static uint32_t created_timers_count = 0;
+static struct Hal_Timer hal_timers[RT_MAX_HAL_TIMERS];
+
+#ifdef RT_HAL_USE_CHAINED_TIMEBASE
+static uint32_t timebase_epoch;
+static uint64_t timebase_origin;
+#else
+static struct TimebaseLatch timebase_latch;
+#endif
 static Tic tic = {};
+static Tic comparator_tic = {};
+static struct TimerQueue timer_queue;
+static struct TimeConversion timer_conversion;
+static struct TimeConversion cycle_conversion;
+static struct CycleCounter cycle_counter;
+static bool is_cycle_counter_available = false;
+static uint32_t delay_overhead_cycles = 0u;
+static struct IdleAccounting idle_accounting;
+static uint64_t watchdog_reset_period_ticks;
 static bool idleTaskIsWatchdogEnabled = false;
 
 rtems_name generate_new_hal_semaphore_name()
@@ -55,6 +140,29 @@ rtems_name generate_new_hal_semaphore_name()
 	return name++;
 }
 
+static rtems_name generate_new_hal_mutex_name()
+{
+	static rtems_name name = rtems_build_name('H', 'M', 0, 0);
+	return name++;
+}
+
+static inline int32_t make_handle(const uint32_t tag, const uint32_t index)
+{
+	return (int32_t)(tag | (index + 1u));
+}
+
+static inline bool get_handle_index(const int32_t handle, const uint32_t tag,
+				    const uint32_t count, uint32_t *const index)
+{
+	const uint32_t value = (uint32_t)handle;
+	if ((value & ~HANDLE_INDEX_MASK) != tag ||
+	    (value & HANDLE_INDEX_MASK) == 0u) {
+		return false;
+	}
+	*index = (value & HANDLE_INDEX_MASK) - 1u;
+	return *index < count;
+}
+
 static Wdt wdt;
 
 inline static void Init_setup_watchdog(void)
@@ -107,18 +215,157 @@ void Hal_ResetWatchdog()
 	Wdt_reset(&wdt);
 }
 
-void timer_irq_handler()
+static void init_timer_conversion(void)
 {
-	__atomic_fetch_add(&reloads_counter, 1u, __ATOMIC_SEQ_CST);
-	ConcurrentAccessFlag_set(&reloads_modified_flag);
+	const bool is_conversion_initialized = TimeConversion_Init(
+		&timer_conversion, SamV71Core_GetMainClockFrequency() /
+					   CLOCK_SELECTION_PRESCALLER);
+	assert(is_conversion_initialized && "Unable to setup time conversion");
+	(void)is_conversion_initialized;
+}
+
+#ifdef RT_HAL_USE_CHAINED_TIMEBASE
+
+static void timebase_overflow_irq_handler(void *arg)
+{
+	(void)arg;
+
+	// The topmost chained channel overflows once per 2^48 ticks
+	__atomic_fetch_add(&timebase_epoch, 1u, __ATOMIC_SEQ_CST);
 
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(&tic, Tic_Channel_2, &status);
+}
+
+static void configure_chained_channel(const Tic_Channel channel,
+				      const Tic_ClockSelection clock_source,
+				      const bool is_overflow_irq_enabled)
+{
+	// Free running 16-bit counter. TIOA is set when the counter wraps
+	// to 0 and cleared in the middle of the range, so the rising edge
+	// of TIOA clocks the next channel in the chain once per wrap.
+	Tic_ChannelConfig config = {};
+	config.isEnabled = true;
+	config.clockSource = clock_source;
+	config.channelMode = Tic_Mode_Waveform;
+	config.wavModeConfig.waveformMode = Tic_WaveformMode_Up;
+	config.wavModeConfig.ra = TIMEBASE_CHANNEL_HALF_RANGE;
+	config.wavModeConfig.rc = 0u;
+	config.wavModeConfig.raCompareEffectOnTioa = Tic_PinEffect_Clear;
+	config.wavModeConfig.rcCompareEffectOnTioa = Tic_PinEffect_Set;
+	config.irqConfig.isCounterOverflowIrqEnabled = is_overflow_irq_enabled;
+	Tic_setChannelConfig(&tic, channel, &config);
+	Tic_enableChannel(&tic, channel);
+}
+
+static void read_timebase_sample(struct ChainedTimebase_Sample *const sample)
+{
+	sample->epoch = __atomic_load_n(&timebase_epoch, __ATOMIC_SEQ_CST);
+	sample->high = Tic_getCounterValue(&tic, Tic_Channel_2);
+	sample->middle = Tic_getCounterValue(&tic, Tic_Channel_1);
+	sample->low = Tic_getCounterValue(&tic, Tic_Channel_0);
+	sample->middle_check = Tic_getCounterValue(&tic, Tic_Channel_1);
+	sample->high_check = Tic_getCounterValue(&tic, Tic_Channel_2);
+	sample->epoch_check =
+		__atomic_load_n(&timebase_epoch, __ATOMIC_SEQ_CST);
+}
+
+static uint64_t read_hardware_ticks(void)
+{
+	// A carry between the channels is detected by reading the upper
+	// channels before and after the lower one. The carry is propagated
+	// within a few MCK cycles after the lower channel wraps, so reads
+	// where the lowest channel is within the guard band are repeated
+	// as well. An inconsistent read is never used: the lowest channel
+	// leaves the guard band within a few ticks, so the read ends after
+	// two passes unless the caller is preempted for a whole period of
+	// the lowest channel on every pass.
+	uint64_t ticks;
+	if (ChainedTimebase_TryRead(read_timebase_sample, &ticks)) {
+		return ticks;
+	}
+
+	// Without preemption the lowest channel leaves the guard band
+	// before the passes are exhausted
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	while (!ChainedTimebase_TryRead(read_timebase_sample, &ticks)) {
+	}
+	rtems_interrupt_local_enable(level);
+
+	return ticks;
+}
+
+static void Hal_InitTimer(void)
+{
+	timebase_epoch = 0u;
+	init_timer_conversion();
+
+	SamV71Core_EnablePeripheralClock(Pmc_PeripheralId_Tc0Ch0);
+	SamV71Core_EnablePeripheralClock(Pmc_PeripheralId_Tc0Ch1);
+	SamV71Core_EnablePeripheralClock(Pmc_PeripheralId_Tc0Ch2);
+
+	// Only the overflow of the last channel in the chain is handled,
+	// see the comment in the single channel variant below.
+	rtems_interrupt_handler_install(Nvic_Irq_Timer0_Channel2, "timer0",
+					RTEMS_INTERRUPT_UNIQUE,
+					timebase_overflow_irq_handler, 0);
+	rtems_interrupt_vector_enable(Nvic_Irq_Timer0_Channel2);
+	Tic_init(&tic, Tic_Id_0);
+	Tic_writeProtect(&tic, false);
+
+	// Block mode: XC1 is driven by TIOA0 and XC2 by TIOA1
+	const Tic_ExternalClockSignalSelection external_clocks = {
+		.xc0 = Tic_Xc0Selection_Tclk0,
+		.xc1 = Tic_Xc1Selection_Tioa0,
+		.xc2 = Tic_Xc2Selection_Tioa1,
+	};
+	Tic_configureExternalClockSignals(&tic, &external_clocks);
+
+	configure_chained_channel(Tic_Channel_2, Tic_ClockSelection_Xc2, true);
+	configure_chained_channel(Tic_Channel_1, Tic_ClockSelection_Xc1,
+				  false);
+	configure_chained_channel(Tic_Channel_0, Tic_ClockSelection_MckBy8,
+				  false);
+
+	// Start all channels at once. The counters are reset on start,
+	// which may already produce a compare event on TIOA, so the value
+	// read directly after the start is taken as the time origin.
+	Tic_syncAllChannels(&tic);
+	timebase_origin = read_hardware_ticks();
+}
+
+#else
+
+void timer_irq_handler()
+{
 	Tic_ChannelStatus status;
 	Tic_getChannelStatus(&tic, Tic_Channel_0, &status);
+
+	// The handler is the only writer. It runs on the counter overflow and
+	// in the middle of the counter range, so the published snapshot is
+	// always less than a period old, even if one interrupt is delayed.
+	TimebaseLatch_Update(&timebase_latch,
+			     Tic_getCounterValue(&tic, Tic_Channel_0));
+}
+
+static uint32_t read_timebase_counter(void)
+{
+	return Tic_getCounterValue(&tic, Tic_Channel_0);
+}
+
+static uint64_t read_hardware_ticks(void)
+{
+	// Lock-free, does not depend on the state of the timer interrupt, so
+	// it can be used from any interrupt handler and from fault handlers
+	return TimebaseLatch_Read(&timebase_latch, read_timebase_counter);
 }
 
 static void Hal_InitTimer(void)
 {
-	reloads_counter = 0u;
+	TimebaseLatch_Init(&timebase_latch);
+	init_timer_conversion();
+
 	SamV71Core_EnablePeripheralClock(Pmc_PeripheralId_Tc0Ch0);
 
 	// NVIC cannot be used for registration of interrupt handlers
@@ -133,54 +380,467 @@ static void Hal_InitTimer(void)
 	Tic_init(&tic, Tic_Id_0);
 	Tic_writeProtect(&tic, false);
 
+	// Free running 16-bit counter, interrupting on overflow and on
+	// RA compare in the middle of the range
 	Tic_ChannelConfig config = {};
 	config.isEnabled = true;
 	config.clockSource = Tic_ClockSelection_MckBy8;
+	config.channelMode = Tic_Mode_Waveform;
+	config.wavModeConfig.waveformMode = Tic_WaveformMode_Up;
+	config.wavModeConfig.ra = TIMEBASE_CHANNEL_HALF_RANGE;
 	config.irqConfig.isCounterOverflowIrqEnabled = true;
+	config.irqConfig.isRaCompareIrqEnabled = true;
 	Tic_setChannelConfig(&tic, Tic_Channel_0, &config);
 
 	Tic_enableChannel(&tic, Tic_Channel_0);
 	Tic_triggerChannel(&tic, Tic_Channel_0);
 }
 
+#endif
+
+static uint64_t get_elapsed_ticks(void)
+{
+#ifdef RT_HAL_USE_CHAINED_TIMEBASE
+	return read_hardware_ticks() - timebase_origin;
+#else
+	return read_hardware_ticks();
+#endif
+}
+
+// DWT registers are accessed only through the following functions
+static inline uint32_t dwt_read_cycle_count(void)
+{
+	return *(volatile uint32_t *)DWT_CYCCNT_ADDRESS;
+}
+
+static bool dwt_enable_cycle_count(void)
+{
+	volatile uint32_t *const demcr = (volatile uint32_t *)DEMCR_ADDRESS;
+	volatile uint32_t *const dwt_ctrl = (volatile uint32_t *)DWT_CTRL_ADDRESS;
+	volatile uint32_t *const dwt_lar = (volatile uint32_t *)DWT_LAR_ADDRESS;
+
+	*demcr |= DEMCR_TRCENA_MASK;
+	*dwt_lar = DWT_LAR_UNLOCK_KEY;
+
+	if ((*dwt_ctrl & DWT_CTRL_NOCYCCNT_MASK) != 0u) {
+		return false;
+	}
+
+	*dwt_ctrl |= DWT_CTRL_CYCCNTENA_MASK;
+
+	// Verify that the counter actually runs, e.g. it is not blocked
+	// by an attached debugger
+	const uint32_t first_sample = dwt_read_cycle_count();
+	for (volatile uint32_t i = 0u; i < CYCLE_COUNTER_PROBE_ITERATIONS;
+	     i++) {
+	}
+
+	return (*dwt_ctrl & DWT_CTRL_CYCCNTENA_MASK) != 0u &&
+	       dwt_read_cycle_count() != first_sample;
+}
+
+static void Hal_InitCycleCounter(void)
+{
+	is_cycle_counter_available =
+		dwt_enable_cycle_count() &&
+		TimeConversion_Init(&cycle_conversion,
+				    SamV71Core_GetProcessorClockFrequency());
+
+	if (!is_cycle_counter_available) {
+		return;
+	}
+
+	CycleCounter_Init(&cycle_counter, dwt_read_cycle_count());
+
+	// Calibrate the fixed cost of a zero length busy wait
+	const uint32_t start = dwt_read_cycle_count();
+	Hal_DelayNs(0u);
+	delay_overhead_cycles =
+		CycleCounter_Difference(start, dwt_read_cycle_count());
+}
+
+static void comparator_start(const Tic_ClockSelection clock_source,
+			     const uint32_t compare_value)
+{
+	// One-shot: the counter is restarted from 0 and stops on RC compare
+	Tic_ChannelConfig config = {};
+	config.isEnabled = true;
+	config.clockSource = clock_source;
+	config.channelMode = Tic_Mode_Waveform;
+	config.wavModeConfig.waveformMode = Tic_WaveformMode_Up_Rc;
+	config.wavModeConfig.isStoppedOnRcCompare = true;
+	config.wavModeConfig.rc = compare_value;
+	config.irqConfig.isRcCompareIrqEnabled = true;
+	Tic_setChannelConfig(&comparator_tic, Tic_Channel_0, &config);
+
+	Tic_enableChannel(&comparator_tic, Tic_Channel_0);
+	Tic_triggerChannel(&comparator_tic, Tic_Channel_0);
+}
+
+static void comparator_arm(const uint64_t now, const uint64_t deadline)
+{
+	const uint64_t delta = deadline > now ? deadline - now : 0u;
+
+	// The comparator runs from the same clock as the timebase. Deadlines
+	// beyond its 16-bit range use a 16 times slower clock, which fires
+	// slightly early; the comparator is then re-armed for the remainder.
+	if (delta == 0u) {
+		comparator_start(Tic_ClockSelection_MckBy8, 1u);
+	} else if (delta <= COMPARATOR_MAX_TICKS) {
+		comparator_start(Tic_ClockSelection_MckBy8, (uint32_t)delta);
+	} else if (delta / COMPARATOR_COARSE_CLOCK_RATIO <=
+		   COMPARATOR_MAX_TICKS) {
+		comparator_start(
+			Tic_ClockSelection_MckBy128,
+			(uint32_t)(delta / COMPARATOR_COARSE_CLOCK_RATIO));
+	} else {
+		comparator_start(Tic_ClockSelection_MckBy128,
+				 COMPARATOR_MAX_TICKS);
+	}
+}
+
+static void service_timer_queue(void)
+{
+	rtems_interrupt_level level;
+
+	// Callbacks are called with interrupts enabled, one at a time. The
+	// generation is taken together with the entry, so that a callback can
+	// tell whether the entry was inserted again before it was called.
+	while (true) {
+		rtems_interrupt_local_disable(level);
+		struct TimerQueue_Entry *const entry =
+			TimerQueue_PopExpired(&timer_queue, get_elapsed_ticks());
+		const uint32_t generation =
+			entry != NULL ? entry->generation : 0u;
+		rtems_interrupt_local_enable(level);
+
+		if (entry == NULL) {
+			break;
+		}
+
+		entry->callback(entry->arg, generation);
+	}
+
+	rtems_interrupt_local_disable(level);
+	const struct TimerQueue_Entry *const head =
+		TimerQueue_Peek(&timer_queue);
+	if (head != NULL) {
+		comparator_arm(get_elapsed_ticks(), head->deadline);
+	} else {
+		Tic_disableChannel(&comparator_tic, Tic_Channel_0);
+	}
+	rtems_interrupt_local_enable(level);
+}
+
+static void comparator_irq_handler(void *arg)
+{
+	(void)arg;
+
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(&comparator_tic, Tic_Channel_0, &status);
+
+	service_timer_queue();
+}
+
+static void Hal_InitComparator(void)
+{
+	TimerQueue_Init(&timer_queue);
+
+	SamV71Core_EnablePeripheralClock(Pmc_PeripheralId_Tc1Ch0);
+	rtems_interrupt_handler_install(Nvic_Irq_Timer1_Channel0, "timer1",
+					RTEMS_INTERRUPT_UNIQUE,
+					comparator_irq_handler, 0);
+	rtems_interrupt_vector_enable(Nvic_Irq_Timer1_Channel0);
+	Tic_init(&comparator_tic, Tic_Id_1);
+	Tic_writeProtect(&comparator_tic, false);
+}
+
+static void wake_sleeping_task(void *arg, uint32_t generation)
+{
+	(void)generation;
+	rtems_event_send((rtems_id)(uintptr_t)arg, RT_HAL_SLEEP_EVENT);
+}
+
+static inline uint64_t deadline_from_ns(const uint64_t absolute_ns)
+{
+	// The error of the conversion grows with the converted value, so
+	// a deadline which would expire early is corrected by converting the
+	// remaining difference, which is small. One timebase tick is added
+	// for the truncation of both conversions.
+	uint64_t deadline =
+		TimeConversion_NsToTicks(&timer_conversion, absolute_ns) + 1u;
+	const uint64_t deadline_ns =
+		TimeConversion_TicksToNs(&timer_conversion, deadline);
+	if (deadline_ns < absolute_ns) {
+		deadline += TimeConversion_NsToTicks(&timer_conversion,
+						     absolute_ns - deadline_ns) +
+			    1u;
+	}
+	return deadline;
+}
+
+static void schedule_timer_entry(struct TimerQueue_Entry *const entry,
+				 const uint64_t deadline)
+{
+	// Called with interrupts disabled
+	if (TimerQueue_Insert(&timer_queue, entry, deadline)) {
+		comparator_arm(get_elapsed_ticks(), deadline);
+	}
+}
+
+static void expire_timer(void *arg, uint32_t generation)
+{
+	struct Hal_Timer *const timer = (struct Hal_Timer *)arg;
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	if (!timer->is_armed || timer->entry.generation != generation) {
+		// Cancelled or started again by an interrupt handler after
+		// the entry was removed from the queue. A restarted timer
+		// expires from its new queue position.
+		rtems_interrupt_local_enable(level);
+		return;
+	}
+	if (timer->period_ns == 0u) {
+		timer->is_armed = false;
+	} else {
+		const uint64_t now_ns = Hal_GetElapsedTimeInNs();
+		timer->expiration_ns += timer->period_ns;
+		if (timer->expiration_ns <= now_ns) {
+			const uint64_t missed_periods =
+				(now_ns - timer->expiration_ns) /
+					timer->period_ns +
+				1u;
+			timer->expiration_ns +=
+				missed_periods * timer->period_ns;
+		}
+		// The comparator is re-armed after all expired entries
+		// are serviced
+		TimerQueue_Insert(&timer_queue, &timer->entry,
+				  deadline_from_ns(timer->expiration_ns));
+	}
+	rtems_interrupt_local_enable(level);
+
+	timer->callback(timer->arg);
+}
+
+static struct Hal_Timer *get_timer(const int32_t id)
+{
+	uint32_t index;
+	if (!get_handle_index(id, TIMER_HANDLE_TAG, created_timers_count,
+			      &index)) {
+		return NULL;
+	}
+	return &hal_timers[index];
+}
+
+static bool start_timer(const int32_t id, const uint64_t expiration_ns,
+			const uint64_t period_ns)
+{
+	struct Hal_Timer *const timer = get_timer(id);
+	if (timer == NULL) {
+		return false;
+	}
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	timer->is_armed = true;
+	timer->expiration_ns = expiration_ns;
+	timer->period_ns = period_ns;
+	schedule_timer_entry(&timer->entry, deadline_from_ns(expiration_ns));
+	rtems_interrupt_local_enable(level);
+
+	return true;
+}
+
+static bool wait_for_deadline(const uint64_t deadline)
+{
+	struct TimerQueue_Entry entry;
+	TimerQueue_InitEntry(&entry, wake_sleeping_task,
+			     (void *)(uintptr_t)rtems_task_self());
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const uint64_t now = get_elapsed_ticks();
+	if (deadline <= now) {
+		rtems_interrupt_local_enable(level);
+		return true;
+	}
+	schedule_timer_entry(&entry, deadline);
+	rtems_interrupt_local_enable(level);
+
+	// The entry is removed from the queue before the event is sent
+	rtems_event_set events;
+	return rtems_event_receive(RT_HAL_SLEEP_EVENT,
+				   RTEMS_EVENT_ALL | RTEMS_WAIT,
+				   RTEMS_NO_TIMEOUT,
+				   &events) == RTEMS_SUCCESSFUL;
+}
+
 bool Hal_Init(void)
 {
 	Init_setup_watchdog();
 	SamV71Core_Init();
 	Hal_InitTimer();
+	Hal_InitCycleCounter();
+	Hal_InitComparator();
+
+	IdleAccounting_Init(&idle_accounting);
+	watchdog_reset_period_ticks = TimeConversion_NsToTicks(
+		&timer_conversion, RT_HAL_WATCHDOG_RESET_PERIOD_NS);
 
 	return true;
 }
 
 uint64_t Hal_GetElapsedTimeInNs(void)
 {
-	uint32_t reloads;
-	uint32_t ticks;
+	return TimeConversion_TicksToNs(&timer_conversion, get_elapsed_ticks());
+}
+
+uint64_t Hal_GetElapsedTicks(void)
+{
+	return get_elapsed_ticks();
+}
+
+uint64_t Hal_TicksToNs(const uint64_t ticks)
+{
+	return TimeConversion_TicksToNs(&timer_conversion, ticks);
+}
+
+uint64_t Hal_GetCycleCount(void)
+{
+	if (!is_cycle_counter_available) {
+		return get_elapsed_ticks();
+	}
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const uint64_t cycles =
+		CycleCounter_Extend(&cycle_counter, dwt_read_cycle_count());
+	rtems_interrupt_local_enable(level);
+
+	return cycles;
+}
+
+uint64_t Hal_CyclesToNs(const uint64_t cycles)
+{
+	if (!is_cycle_counter_available) {
+		return TimeConversion_TicksToNs(&timer_conversion, cycles);
+	}
+
+	return TimeConversion_TicksToNs(&cycle_conversion, cycles);
+}
 
-	do {
-		ConcurrentAccessFlag_reset(&reloads_modified_flag);
-		reloads = __atomic_load_n(&reloads_counter, __ATOMIC_SEQ_CST);
-		ticks = Tic_getCounterValue(&tic, Tic_Channel_0);
-	} while (ConcurrentAccessFlag_check(&reloads_modified_flag));
+void Hal_DelayNs(const uint64_t time_ns)
+{
+	if (!is_cycle_counter_available) {
+		const uint64_t end = get_elapsed_ticks() +
+				     TimeConversion_NsToTicks(&timer_conversion,
+							      time_ns);
+		while (get_elapsed_ticks() < end) {
+		}
+		return;
+	}
 
-	const uint64_t total_ticks =
-		(uint64_t)(reloads * TICKS_PER_RELOAD) + (uint64_t)ticks;
-	const double clock_frequency =
-		(double)SamV71Core_GetMainClockFrequency() /
-		CLOCK_SELECTION_PRESCALLER;
+	uint32_t previous = dwt_read_cycle_count();
+	uint64_t cycles = TimeConversion_NsToTicks(&cycle_conversion, time_ns);
+	cycles = cycles > delay_overhead_cycles ?
+			 cycles - delay_overhead_cycles :
+			 0u;
 
-	return (uint64_t)((double)total_ticks /
-			  (clock_frequency / NANOSECOND_IN_SECOND));
+	// The raw counter is used directly, so the delay is not affected
+	// by the cost of extending it, and it may span multiple wraps
+	uint64_t elapsed = 0u;
+	while (elapsed < cycles) {
+		const uint32_t current = dwt_read_cycle_count();
+		elapsed += CycleCounter_Difference(previous, current);
+		previous = current;
+	}
 }
 
 bool Hal_SleepNs(uint64_t time_ns)
 {
-	const double sleep_tick_count =
-		time_ns * ((double)SamV71Core_GetMainClockFrequency() /
-			   NANOSECOND_IN_SECOND);
+	return Hal_SleepUntilNs(Hal_GetElapsedTimeInNs() + time_ns);
+}
 
-	return rtems_task_wake_after((rtems_interval)sleep_tick_count) ==
-	       RTEMS_SUCCESSFUL;
+bool Hal_SleepUntilNs(const uint64_t absolute_ns)
+{
+	const uint64_t tick_ns =
+		(uint64_t)rtems_configuration_get_microseconds_per_tick() *
+		NANOSECONDS_IN_MICROSECOND;
+
+	// Coarse wait: rtems_task_wake_after(n) returns after at most n
+	// clock ticks, so waking one tick early never overshoots.
+	uint64_t now_ns = Hal_GetElapsedTimeInNs();
+	while (absolute_ns > now_ns &&
+	       (absolute_ns - now_ns) / tick_ns > 1u) {
+		uint64_t ticks = (absolute_ns - now_ns) / tick_ns - 1u;
+		if (ticks > UINT32_MAX) {
+			ticks = UINT32_MAX;
+		}
+		if (rtems_task_wake_after((rtems_interval)ticks) !=
+		    RTEMS_SUCCESSFUL) {
+			return false;
+		}
+		now_ns = Hal_GetElapsedTimeInNs();
+	}
+
+	if (absolute_ns <= now_ns) {
+		return true;
+	}
+
+	// Fine wait for the remaining part of the tick
+	return wait_for_deadline(deadline_from_ns(absolute_ns));
+}
+
+int32_t Hal_TimerCreate(const Hal_TimerCallback callback, void *const arg)
+{
+	if (created_timers_count >= RT_MAX_HAL_TIMERS || callback == NULL) {
+		return 0;
+	}
+
+	struct Hal_Timer *const timer = &hal_timers[created_timers_count];
+	TimerQueue_InitEntry(&timer->entry, expire_timer, timer);
+	timer->callback = callback;
+	timer->arg = arg;
+	timer->is_armed = false;
+	timer->expiration_ns = 0u;
+	timer->period_ns = 0u;
+
+	return make_handle(TIMER_HANDLE_TAG, created_timers_count++);
+}
+
+bool Hal_TimerFireAtNs(const int32_t id, const uint64_t absolute_ns)
+{
+	return start_timer(id, absolute_ns, 0u);
+}
+
+bool Hal_TimerFireEveryNs(const int32_t id, const uint64_t period_ns)
+{
+	if (period_ns == 0u) {
+		return false;
+	}
+
+	return start_timer(id, Hal_GetElapsedTimeInNs() + period_ns,
+			   period_ns);
+}
+
+bool Hal_TimerCancel(const int32_t id)
+{
+	struct Hal_Timer *const timer = get_timer(id);
+	if (timer == NULL) {
+		return false;
+	}
+
+	// The comparator is left armed, an interrupt with no expired
+	// entries only re-arms it for the new head of the queue
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	timer->is_armed = false;
+	TimerQueue_Remove(&timer_queue, &timer->entry);
+	rtems_interrupt_local_enable(level);
+
+	return true;
 }
 
 int32_t Hal_SemaphoreCreate(void)
@@ -189,46 +849,355 @@ int32_t Hal_SemaphoreCreate(void)
 		return 0;
 	}
 
+	struct Hal_Semaphore *const semaphore =
+		&hal_semaphores[created_semaphores_count];
+	memset(semaphore, 0, sizeof(struct Hal_Semaphore));
+
 	const rtems_status_code status_code = rtems_semaphore_create(
 		generate_new_hal_semaphore_name(),
 		1, // Initial value, unlocked
 		RTEMS_BINARY_SEMAPHORE,
 		0, // Priority ceiling
-		&hal_semaphore_ids[created_semaphores_count]);
+		&semaphore->id);
 
 	if (status_code == RTEMS_SUCCESSFUL) {
-		return hal_semaphore_ids[created_semaphores_count++];
+		return make_handle(SEMAPHORE_HANDLE_TAG,
+				   created_semaphores_count++);
 	}
 
 	return 0;
 }
 
+static struct Hal_Semaphore *get_semaphore(const int32_t id)
+{
+	uint32_t index;
+	if (!get_handle_index(id, SEMAPHORE_HANDLE_TAG,
+			      created_semaphores_count, &index)) {
+		return NULL;
+	}
+	return &hal_semaphores[index];
+}
+
+static bool obtain_semaphore(struct Hal_Semaphore *const semaphore,
+			     const bool is_waiting, const rtems_interval timeout)
+{
+	const uint64_t start_ticks = get_elapsed_ticks();
+
+	// Attempt without waiting first, to tell contended acquisitions apart
+	rtems_status_code result =
+		rtems_semaphore_obtain(semaphore->id, RTEMS_NO_WAIT, 0);
+	const bool is_contended = result == RTEMS_UNSATISFIED;
+	if (is_contended && is_waiting) {
+		result = rtems_semaphore_obtain(semaphore->id, RTEMS_WAIT,
+						timeout);
+	}
+
+	if (result != RTEMS_SUCCESSFUL) {
+		return false;
+	}
+
+	// Statistics are modified only by the holder of the semaphore, the
+	// interrupts are disabled to provide consistent snapshots to readers.
+	// The semaphore is recursive, the hold time is measured from the
+	// outermost obtain.
+	const uint64_t now = get_elapsed_ticks();
+	const uint64_t wait_ticks = is_contended ? now - start_ticks : 0u;
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	if (semaphore->nesting_depth == 0u) {
+		semaphore->obtain_ticks = now;
+		semaphore->holder = rtems_task_self();
+	}
+	semaphore->nesting_depth++;
+	semaphore->acquisitions_count++;
+	if (is_contended) {
+		semaphore->contended_acquisitions_count++;
+		semaphore->total_wait_ticks += wait_ticks;
+		if (wait_ticks > semaphore->maximum_wait_ticks) {
+			semaphore->maximum_wait_ticks = wait_ticks;
+		}
+	}
+	rtems_interrupt_local_enable(level);
+
+	return true;
+}
+
 bool Hal_SemaphoreObtain(int32_t id)
 {
-	if (created_semaphores_count >= RT_MAX_HAL_SEMAPHORES) {
+	struct Hal_Semaphore *const semaphore = get_semaphore(id);
+	if (semaphore == NULL) {
+		return false;
+	}
+
+	return obtain_semaphore(semaphore, true, RTEMS_NO_TIMEOUT);
+}
+
+bool Hal_SemaphoreTryObtain(int32_t id)
+{
+	struct Hal_Semaphore *const semaphore = get_semaphore(id);
+	if (semaphore == NULL) {
 		return false;
 	}
 
-	const rtems_status_code result =
-		rtems_semaphore_obtain(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
-	return result == RTEMS_SUCCESSFUL;
+	return obtain_semaphore(semaphore, false, 0);
+}
+
+bool Hal_SemaphoreObtainTimeoutNs(int32_t id, const uint64_t timeout_ns)
+{
+	struct Hal_Semaphore *const semaphore = get_semaphore(id);
+	if (semaphore == NULL) {
+		return false;
+	}
+
+	if (timeout_ns == 0u) {
+		return obtain_semaphore(semaphore, false, 0);
+	}
+
+	// The timeout is rounded up to whole clock ticks, and one tick is
+	// added for the partially elapsed current tick, so that the wait is
+	// never shorter than requested. RTEMS_NO_TIMEOUT is 0, so the result
+	// cannot be 0.
+	const uint64_t tick_ns =
+		(uint64_t)rtems_configuration_get_microseconds_per_tick() *
+		NANOSECONDS_IN_MICROSECOND;
+	uint64_t ticks = (timeout_ns + tick_ns - 1u) / tick_ns + 1u;
+	if (ticks > UINT32_MAX) {
+		ticks = UINT32_MAX;
+	}
+
+	return obtain_semaphore(semaphore, true, (rtems_interval)ticks);
 }
 
 bool Hal_SemaphoreRelease(int32_t id)
 {
-	if (created_semaphores_count >= RT_MAX_HAL_SEMAPHORES) {
+	struct Hal_Semaphore *const semaphore = get_semaphore(id);
+	if (semaphore == NULL) {
+		return false;
+	}
+
+	// Only the holder can release the semaphore, other threads would
+	// corrupt the nesting depth
+	if (semaphore->nesting_depth == 0u ||
+	    semaphore->holder != rtems_task_self()) {
+		return false;
+	}
+
+	// The next holder overwrites the obtain time and the nesting depth,
+	// so they are updated before the release
+	const uint64_t hold_ticks =
+		get_elapsed_ticks() - semaphore->obtain_ticks;
+	const bool is_outermost = semaphore->nesting_depth == 1u;
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	semaphore->nesting_depth--;
+	if (is_outermost) {
+		semaphore->holder = 0;
+		if (hold_ticks > semaphore->maximum_hold_ticks) {
+			semaphore->maximum_hold_ticks = hold_ticks;
+		}
+	}
+	rtems_interrupt_local_enable(level);
+
+	return rtems_semaphore_release(semaphore->id) == RTEMS_SUCCESSFUL;
+}
+
+bool Hal_SemaphoreGetStatistics(
+	int32_t id, struct Hal_SemaphoreStatistics *const statistics)
+{
+	const struct Hal_Semaphore *const semaphore = get_semaphore(id);
+	if (semaphore == NULL || statistics == NULL) {
+		return false;
+	}
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const struct Hal_Semaphore snapshot = *semaphore;
+	rtems_interrupt_local_enable(level);
+
+	statistics->acquisitions_count = snapshot.acquisitions_count;
+	statistics->contended_acquisitions_count =
+		snapshot.contended_acquisitions_count;
+	statistics->total_wait_time_ns = TimeConversion_TicksToNs(
+		&timer_conversion, snapshot.total_wait_ticks);
+	statistics->maximum_wait_time_ns = TimeConversion_TicksToNs(
+		&timer_conversion, snapshot.maximum_wait_ticks);
+	statistics->maximum_hold_time_ns = TimeConversion_TicksToNs(
+		&timer_conversion, snapshot.maximum_hold_ticks);
+
+	return true;
+}
+
+int32_t Hal_MutexCreate(const enum Hal_MutexProtocol protocol,
+			const uint32_t ceiling)
+{
+	if (created_mutexes_count >= RT_MAX_HAL_MUTEXES) {
+		return 0;
+	}
+
+	struct Hal_Mutex *const mutex = &hal_mutexes[created_mutexes_count];
+	rtems_status_code status_code;
+
+	switch (protocol) {
+	case Hal_MutexProtocol_None:
+		// Semaphore used only to suspend contending threads,
+		// released by the owner when it observes contention
+		status_code = rtems_semaphore_create(
+			generate_new_hal_mutex_name(),
+			0, // Initial value, no pending wakeup
+			RTEMS_SIMPLE_BINARY_SEMAPHORE | RTEMS_PRIORITY,
+			0, // Priority ceiling
+			&mutex->semaphore_id);
+		break;
+	case Hal_MutexProtocol_PriorityInheritance:
+		// The priority can be inherited only by a thread which holds
+		// the RTOS semaphore, so the atomic fast path is not used
+		status_code = rtems_semaphore_create(
+			generate_new_hal_mutex_name(),
+			1, // Initial value, unlocked
+			RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY |
+				RTEMS_INHERIT_PRIORITY,
+			0, // Priority ceiling
+			&mutex->semaphore_id);
+		break;
+	case Hal_MutexProtocol_PriorityCeiling:
+		status_code = rtems_semaphore_create(
+			generate_new_hal_mutex_name(),
+			1, // Initial value, unlocked
+			RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY |
+				RTEMS_PRIORITY_CEILING,
+			(rtems_task_priority)ceiling, &mutex->semaphore_id);
+		break;
+	default:
+		return 0;
+	}
+
+	if (status_code != RTEMS_SUCCESSFUL) {
+		return 0;
+	}
+
+	MutexState_Init(&mutex->state);
+	mutex->owner = 0;
+	mutex->protocol = protocol;
+
+	return make_handle(MUTEX_HANDLE_TAG, created_mutexes_count++);
+}
+
+static bool obtain_contended_mutex(struct Hal_Mutex *const mutex,
+				   const rtems_id self)
+{
+	while (!MutexState_LockContended(&mutex->state)) {
+		if (rtems_semaphore_obtain(mutex->semaphore_id, RTEMS_WAIT,
+					   RTEMS_NO_TIMEOUT) !=
+		    RTEMS_SUCCESSFUL) {
+			return false;
+		}
+	}
+
+	mutex->owner = self;
+	return true;
+}
+
+bool Hal_MutexObtain(const int32_t id)
+{
+	uint32_t index;
+	if (!get_handle_index(id, MUTEX_HANDLE_TAG, created_mutexes_count,
+			      &index)) {
+		return false;
+	}
+
+	struct Hal_Mutex *const mutex = &hal_mutexes[index];
+	if (mutex->protocol != Hal_MutexProtocol_None) {
+		return rtems_semaphore_obtain(mutex->semaphore_id, RTEMS_WAIT,
+					      RTEMS_NO_TIMEOUT) ==
+		       RTEMS_SUCCESSFUL;
+	}
+
+	const rtems_id self = rtems_task_self();
+	if (MutexState_TryLock(&mutex->state)) {
+		mutex->owner = self;
+		return true;
+	}
+
+	if (mutex->owner == self) {
+		// Mutexes are not recursive
+		return false;
+	}
+
+	return obtain_contended_mutex(mutex, self);
+}
+
+bool Hal_MutexRelease(const int32_t id)
+{
+	uint32_t index;
+	if (!get_handle_index(id, MUTEX_HANDLE_TAG, created_mutexes_count,
+			      &index)) {
+		return false;
+	}
+
+	struct Hal_Mutex *const mutex = &hal_mutexes[index];
+	if (mutex->protocol != Hal_MutexProtocol_None) {
+		return rtems_semaphore_release(mutex->semaphore_id) ==
+		       RTEMS_SUCCESSFUL;
+	}
+
+	if (mutex->owner != rtems_task_self()) {
 		return false;
 	}
 
-	const rtems_status_code result = rtems_semaphore_release(id);
-	return result == RTEMS_SUCCESSFUL;
+	mutex->owner = 0;
+	if (!MutexState_Unlock(&mutex->state)) {
+		return true;
+	}
+
+	return rtems_semaphore_release(mutex->semaphore_id) ==
+	       RTEMS_SUCCESSFUL;
 }
 
 void Hal_IdleTask(uintptr_t ignored)
 {
+	uint64_t last_watchdog_reset = get_elapsed_ticks();
+	Hal_ResetWatchdog();
+
 	while (1) {
-		Hal_ResetWatchdog();
+		// Interrupts are masked with PRIMASK, WFI still wakes up on
+		// a pending interrupt, but the handler runs only after the
+		// exit from the idle state is recorded. The time spent in
+		// interrupt handlers is therefore not counted as idle.
+		__asm__ volatile("cpsid i" ::: "memory");
+
+		const uint64_t entry_time = get_elapsed_ticks();
+		if (entry_time - last_watchdog_reset >=
+		    watchdog_reset_period_ticks) {
+			Hal_ResetWatchdog();
+			last_watchdog_reset = entry_time;
+		}
+
+		IdleAccounting_Enter(&idle_accounting, entry_time);
+		__asm__ volatile("dsb\n"
+				 "wfi\n" ::
+					 : "memory");
+		IdleAccounting_Exit(&idle_accounting, get_elapsed_ticks());
+
+		__asm__ volatile("cpsie i\n"
+				 "isb\n" ::
+					 : "memory");
+	}
+}
+
+bool Hal_GetIdleTimeInNs(uint64_t *const idle_time_ns)
+{
+	uint64_t idle_ticks;
+	uint32_t idle_periods_count;
+	IdleAccounting_Read(&idle_accounting, &idle_ticks,
+			    &idle_periods_count);
+
+	if (idle_periods_count == 0u) {
+		// Hal_IdleTask is not used as the idle task body
+		return false;
 	}
+
+	*idle_time_ns = TimeConversion_TicksToNs(&timer_conversion, idle_ticks);
+	return true;
 }
 
 enum Reset_Reason Hal_GetResetReason()
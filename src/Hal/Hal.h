@@ -33,6 +33,43 @@
 #define RT_MAX_HAL_SEMAPHORES 8
 #endif
 
+#ifndef RT_MAX_HAL_MUTEXES
+#define RT_MAX_HAL_MUTEXES 8
+#endif
+
+#ifndef RT_MAX_HAL_TIMERS
+#define RT_MAX_HAL_TIMERS 8
+#endif
+
+/**
+ * @brief   Typedef of function called when a Hal timer expires. The function
+ *          is called from the interrupt context.
+ *
+ * @param[in] arg   user argument of the timer
+ */
+typedef void (*Hal_TimerCallback)(void *arg);
+
+/**
+ * @brief   Enum representing the protocol used by a Hal mutex to bound
+ *          priority inversion
+ */
+enum Hal_MutexProtocol {
+	Hal_MutexProtocol_None = 0, ///< No protocol
+	Hal_MutexProtocol_PriorityInheritance = 1, ///< Priority inheritance
+	Hal_MutexProtocol_PriorityCeiling = 2, ///< Immediate priority ceiling
+};
+
+/**
+ * @brief   Struct representing usage statistics of a Hal semaphore
+ */
+struct Hal_SemaphoreStatistics {
+	uint32_t acquisitions_count;
+	uint32_t contended_acquisitions_count;
+	uint64_t total_wait_time_ns;
+	uint64_t maximum_wait_time_ns;
+	uint64_t maximum_hold_time_ns;
+};
+
 /**
  * @brief               Initializes the Hal module.
  *
@@ -45,10 +82,74 @@ bool Hal_Init(void);
  * @brief               Returns time elapsed from the initialization of the
  *                      runtime
  *
+ *                      By default the timebase is TC0 channel 0 extended in
+ *                      software, the extension is refreshed twice per
+ *                      counter period. The read is lock-free and does not
+ *                      depend on the state of the timer interrupt, so it
+ *                      can be used from threads, interrupt handlers of any
+ *                      priority and fault handlers. When
+ *                      RT_HAL_USE_CHAINED_TIMEBASE is defined, TC0 channels
+ *                      0-2 are chained in hardware into a 48-bit counter,
+ *                      which requires no periodic interrupt.
+ *
  * @return              Time elapsed from the initialization of the runtime
  */
 uint64_t Hal_GetElapsedTimeInNs(void);
 
+/**
+ * @brief               Returns the raw ticks of the Hal timebase, without
+ *                      the conversion to nanoseconds. Intended for hot
+ *                      paths which store timestamps and convert them
+ *                      later with Hal_TicksToNs.
+ *
+ * @return              Ticks elapsed from the initialization of the runtime
+ */
+uint64_t Hal_GetElapsedTicks(void);
+
+/**
+ * @brief               Converts a number of ticks returned by
+ *                      Hal_GetElapsedTicks into nanoseconds
+ *
+ * @param[in] ticks     number of ticks
+ *
+ * @return              Time in nanoseconds
+ */
+uint64_t Hal_TicksToNs(const uint64_t ticks);
+
+/**
+ * @brief               Returns the number of processor cycles counted by
+ *                      the DWT cycle counter, extended to 64 bits.
+ *
+ *                      The extension is correct only if the counter is
+ *                      sampled at least once per 2^32 cycles. If the DWT
+ *                      cycle counter is not available, ticks of the Hal
+ *                      timebase are returned instead. In both cases
+ *                      Hal_CyclesToNs converts the result to nanoseconds.
+ *
+ * @return              Current cycle count
+ */
+uint64_t Hal_GetCycleCount(void);
+
+/**
+ * @brief               Converts a number of cycles returned by
+ *                      Hal_GetCycleCount into nanoseconds
+ *
+ * @param[in] cycles    number of cycles
+ *
+ * @return              Time in nanoseconds
+ */
+uint64_t Hal_CyclesToNs(const uint64_t cycles);
+
+/**
+ * @brief               Busy-waits for at least the given amount of time.
+ *                      The fixed cost of the call is calibrated during
+ *                      initialization and subtracted from the delay.
+ *                      Intended for short peripheral settle times only.
+ *
+ * @param[in] time_ns   time in nanoseconds
+ */
+void Hal_DelayNs(const uint64_t time_ns);
+
 /**
  * @brief               Suspends the current thread for the given amount of time
  *
@@ -58,12 +159,86 @@ uint64_t Hal_GetElapsedTimeInNs(void);
  */
 bool Hal_SleepNs(uint64_t time_ns);
 
+/**
+ * @brief               Suspends the current thread until the given time.
+ *                      Whole clock ticks are waited using the RTOS, the
+ *                      remainder is waited on a TC1 channel 0 compare
+ *                      interrupt, so the wakeup precision is independent
+ *                      of the RTOS tick length. The wakeup is signaled
+ *                      with RT_HAL_SLEEP_EVENT (RTEMS_EVENT_31 by default).
+ *
+ * @param[in] absolute_ns   wakeup time, in the time base of
+ *                          Hal_GetElapsedTimeInNs
+ *
+ * @return              Bool indicating whether the sleep was successful
+ */
+bool Hal_SleepUntilNs(const uint64_t absolute_ns);
+
+/**
+ * @brief               Creates a high resolution timer. This function is not
+ *                      thread safe, but it is assumed to be used only during
+ *                      system initialization, from a single thread/Init task.
+ *
+ *                      All timers share the TC1 channel 0 comparator with
+ *                      Hal_SleepUntilNs, their deadlines are kept in a single
+ *                      sorted queue. The timer is created stopped.
+ *
+ * @param[in] callback  function called from the interrupt context when the
+ *                      timer expires
+ * @param[in] arg       argument passed to the callback
+ *
+ * @return              ID of the created timer, 0 on failure
+ */
+int32_t Hal_TimerCreate(const Hal_TimerCallback callback, void *const arg);
+
+/**
+ * @brief               Starts the timer to expire once at the given time.
+ *                      A running timer is restarted.
+ *
+ * @param[in] id        id of the timer
+ * @param[in] absolute_ns   expiration time, in the time base of
+ *                          Hal_GetElapsedTimeInNs
+ *
+ * @return              Bool indicating whether the timer was started
+ */
+bool Hal_TimerFireAtNs(const int32_t id, const uint64_t absolute_ns);
+
+/**
+ * @brief               Starts the timer to expire periodically, the first
+ *                      expiration is one period from now. Expirations are
+ *                      computed from the start time, so they do not drift.
+ *                      Expirations missed because of a late interrupt are
+ *                      skipped. A running timer is restarted.
+ *
+ * @param[in] id        id of the timer
+ * @param[in] period_ns period in nanoseconds, greater than 0
+ *
+ * @return              Bool indicating whether the timer was started
+ */
+bool Hal_TimerFireEveryNs(const int32_t id, const uint64_t period_ns);
+
+/**
+ * @brief               Stops the timer. The callback is not called after
+ *                      this function returns, unless it is already running.
+ *
+ * @param[in] id        id of the timer
+ *
+ * @return              Bool indicating whether the timer was stopped
+ */
+bool Hal_TimerCancel(const int32_t id);
+
 /**
  * @brief               Creates an RTOS backed semaphore. This function is not
  *                      thread safe, but it is assumed to be used only during
  *                      system initialization, from a single thread/Init task.
  *
- * @return              ID of the created semaphore
+ *                      The returned ID is a Hal handle, validated by the
+ *                      other Hal_Semaphore functions in constant time. It is
+ *                      not the ID of the RTOS semaphore, which was returned
+ *                      by earlier versions, and cannot be passed to RTOS
+ *                      directives.
+ *
+ * @return              ID of the created semaphore, 0 on failure
  */
 int32_t Hal_SemaphoreCreate(void);
 
@@ -77,9 +252,34 @@ int32_t Hal_SemaphoreCreate(void);
  */
 bool Hal_SemaphoreObtain(int32_t id);
 
+/**
+ * @brief               Obtains the indicated semaphore if it is available,
+ *                      without suspending the current thread
+ *
+ * @param[in] id        id of the semaphore
+ *
+ * @return              Bool indicating whether the semaphore was obtained
+ */
+bool Hal_SemaphoreTryObtain(int32_t id);
+
+/**
+ * @brief               Obtains the indicated semaphore, suspending the
+ *                      execution of the current thread for at most the
+ *                      given time. The timeout is rounded up to whole
+ *                      clock ticks, so the thread may wait up to two ticks
+ *                      longer.
+ *
+ * @param[in] id        id of the semaphore
+ * @param[in] timeout_ns    timeout in nanoseconds, 0 does not wait
+ *
+ * @return              Bool indicating whether the semaphore was obtained
+ */
+bool Hal_SemaphoreObtainTimeoutNs(int32_t id, const uint64_t timeout_ns);
+
 /**
  * @brief               Releases the indicated semaphore, potentially resuming
- *                      threads waiting on the semaphore
+ *                      threads waiting on the semaphore. Only the thread
+ *                      holding the semaphore can release it.
  *
  * @param[in] id        id of the semaphore
  *
@@ -88,12 +288,91 @@ bool Hal_SemaphoreObtain(int32_t id);
 bool Hal_SemaphoreRelease(int32_t id);
 
 /**
- * @brief               Main function of IDLE task.
+ * @brief               Returns usage statistics of the indicated semaphore.
+ *                      An acquisition is contended if the semaphore was not
+ *                      available immediately. Wait time is accumulated for
+ *                      contended acquisitions only. The semaphore is
+ *                      recursive, hold time is measured from the outermost
+ *                      obtain to the matching release.
+ *
+ * @param[in] id        id of the semaphore
+ * @param[out] statistics   statistics of the semaphore
+ *
+ * @return              Bool indicating whether the query was successful
+ */
+bool Hal_SemaphoreGetStatistics(
+	int32_t id, struct Hal_SemaphoreStatistics *const statistics);
+
+/**
+ * @brief               Creates a mutex. This function is not thread safe,
+ *                      but it is assumed to be used only during system
+ *                      initialization, from a single thread/Init task.
+ *
+ *                      Mutexes without a protocol are obtained and released
+ *                      with a single atomic operation when uncontended. The
+ *                      backing RTOS semaphore is used only to suspend
+ *                      contending threads. Mutexes with priority inheritance
+ *                      or a priority ceiling are always backed directly by
+ *                      an RTOS semaphore with the given protocol, as the
+ *                      RTOS can adjust the priority of the owner only if it
+ *                      holds the semaphore. Priorities are then inherited
+ *                      through nested mutexes and do not override changes
+ *                      of the base priority of the owner. Each mutex uses
+ *                      one RTOS semaphore.
+ *
+ * @param[in] protocol  protocol bounding priority inversion
+ * @param[in] ceiling   priority ceiling, used only with
+ *                      Hal_MutexProtocol_PriorityCeiling
+ *
+ * @return              ID of the created mutex, 0 on failure
+ */
+int32_t Hal_MutexCreate(const enum Hal_MutexProtocol protocol,
+			const uint32_t ceiling);
+
+/**
+ * @brief               Obtains the indicated mutex, suspending the
+ *                      execution of the current thread if necessary.
+ *                      Mutexes are not recursive and shall be used only
+ *                      from threads.
+ *
+ * @param[in] id        id of the mutex
+ *
+ * @return              Bool indicating whether the obtain was successful
+ */
+bool Hal_MutexObtain(const int32_t id);
+
+/**
+ * @brief               Releases the indicated mutex, potentially resuming
+ *                      threads waiting on the mutex. Only the owner of the
+ *                      mutex can release it.
+ *
+ * @param[in] id        id of the mutex
+ *
+ * @return              Bool indicating whether the release was successful
+ */
+bool Hal_MutexRelease(const int32_t id);
+
+/**
+ * @brief               Main function of IDLE task. The processor sleeps with
+ *                      WFI between interrupts, the watchdog is reset at most
+ *                      once per RT_HAL_WATCHDOG_RESET_PERIOD_NS and the time
+ *                      spent in the idle state is accounted.
  *
  * @param[in] ignored   Param required by rtems_task_entry signature - no meaningful value passed.
  */
 void Hal_IdleTask(uintptr_t ignored);
 
+/**
+ * @brief               Returns total time spent in the idle state by
+ *                      Hal_IdleTask, excluding interrupt handlers
+ *
+ * @param[out] idle_time_ns     idle time in nanoseconds
+ *
+ * @return              Bool indicating whether the idle time is available,
+ *                      i.e. whether Hal_IdleTask is used as the idle task
+ */
+bool Hal_GetIdleTimeInNs(uint64_t *const idle_time_ns);
+
 /**
  * @brief               Returns information about reason of hardware reset
  *
@@ -0,0 +1,67 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IdleAccounting.h"
+
+void IdleAccounting_Init(struct IdleAccounting *const accounting)
+{
+	accounting->sequence = 0u;
+	accounting->idle_periods_count = 0u;
+	accounting->total_idle_time = 0u;
+	accounting->entry_time = 0u;
+}
+
+void IdleAccounting_Enter(struct IdleAccounting *const accounting,
+			  const uint64_t now)
+{
+	accounting->entry_time = now;
+}
+
+void IdleAccounting_Exit(struct IdleAccounting *const accounting,
+			 const uint64_t now)
+{
+	const uint64_t idle_time =
+		now > accounting->entry_time ? now - accounting->entry_time :
+					       0u;
+
+	// Odd sequence marks an update in progress
+	__atomic_fetch_add(&accounting->sequence, 1u, __ATOMIC_ACQ_REL);
+	accounting->total_idle_time += idle_time;
+	accounting->idle_periods_count++;
+	__atomic_fetch_add(&accounting->sequence, 1u, __ATOMIC_ACQ_REL);
+}
+
+void IdleAccounting_Read(const struct IdleAccounting *const accounting,
+			 uint64_t *const total_idle_time,
+			 uint32_t *const idle_periods_count)
+{
+	uint32_t sequence;
+
+	// The writer updates the accounting with interrupts disabled, so
+	// on a single core the loop repeats at most once
+	do {
+		sequence =
+			__atomic_load_n(&accounting->sequence, __ATOMIC_ACQUIRE);
+		*total_idle_time = accounting->total_idle_time;
+		*idle_periods_count = accounting->idle_periods_count;
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while ((sequence & 1u) != 0u ||
+		 sequence != __atomic_load_n(&accounting->sequence,
+					     __ATOMIC_ACQUIRE));
+}
@@ -0,0 +1,83 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IDLEACCOUNTING_H
+#define IDLEACCOUNTING_H
+
+/**
+ * @file    IdleAccounting.h
+ * @brief   Accounting of time spent by the processor in the idle state.
+ *
+ * Times are expressed in arbitrary units of the clock provided by the user.
+ * There shall be a single writer (the idle task), which updates the
+ * accounting with interrupts disabled. Readers get a consistent snapshot
+ * through a sequence counter. The module does not access the hardware.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief   Struct representing accumulated idle time
+ */
+struct IdleAccounting {
+	uint32_t sequence;
+	uint32_t idle_periods_count;
+	uint64_t total_idle_time;
+	uint64_t entry_time;
+};
+
+/**
+ * @brief                   Initializes the accounting
+ *
+ * @param[out] accounting   accounting to initialize
+ */
+void IdleAccounting_Init(struct IdleAccounting *const accounting);
+
+/**
+ * @brief                   Records entry into the idle state
+ *
+ * @param[in,out] accounting    accounting
+ * @param[in] now               current time
+ */
+void IdleAccounting_Enter(struct IdleAccounting *const accounting,
+			  const uint64_t now);
+
+/**
+ * @brief                   Records exit from the idle state and accumulates
+ *                          the time spent in it
+ *
+ * @param[in,out] accounting    accounting
+ * @param[in] now               current time
+ */
+void IdleAccounting_Exit(struct IdleAccounting *const accounting,
+			 const uint64_t now);
+
+/**
+ * @brief                   Returns consistent snapshot of the accounting
+ *
+ * @param[in] accounting            accounting
+ * @param[out] total_idle_time      time spent in the idle state
+ * @param[out] idle_periods_count   number of completed idle periods
+ */
+void IdleAccounting_Read(const struct IdleAccounting *const accounting,
+			 uint64_t *const total_idle_time,
+			 uint32_t *const idle_periods_count);
+
+#endif
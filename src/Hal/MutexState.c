@@ -0,0 +1,49 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MutexState.h"
+
+#define MUTEX_UNLOCKED 0u
+#define MUTEX_LOCKED 1u
+#define MUTEX_CONTENDED 2u
+
+void MutexState_Init(struct MutexState *const state)
+{
+	__atomic_store_n(&state->value, MUTEX_UNLOCKED, __ATOMIC_RELAXED);
+}
+
+bool MutexState_TryLock(struct MutexState *const state)
+{
+	uint32_t expected = MUTEX_UNLOCKED;
+	return __atomic_compare_exchange_n(&state->value, &expected,
+					   MUTEX_LOCKED, false,
+					   __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+bool MutexState_LockContended(struct MutexState *const state)
+{
+	return __atomic_exchange_n(&state->value, MUTEX_CONTENDED,
+				   __ATOMIC_ACQUIRE) == MUTEX_UNLOCKED;
+}
+
+bool MutexState_Unlock(struct MutexState *const state)
+{
+	return __atomic_exchange_n(&state->value, MUTEX_UNLOCKED,
+				   __ATOMIC_RELEASE) == MUTEX_CONTENDED;
+}
@@ -0,0 +1,86 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MUTEXSTATE_H
+#define MUTEXSTATE_H
+
+/**
+ * @file    MutexState.h
+ * @brief   Atomic lock word of a mutex with an uncontended fast path.
+ *
+ * Uncontended obtain and release are single atomic operations, which
+ * compile into LDREX/STREX sequences on ARMv7-M. Contending threads mark
+ * the lock word, so that the owner knows it must wake one of them on
+ * release. Suspending and waking threads is left to the user, woken
+ * threads retry MutexState_LockContended. The module does not depend on
+ * RTEMS nor on the BSP.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief   Struct representing the lock word of a mutex
+ */
+struct MutexState {
+	uint32_t value;
+};
+
+/**
+ * @brief                   Initializes the lock word as unlocked
+ *
+ * @param[out] state        lock word to initialize
+ */
+void MutexState_Init(struct MutexState *const state);
+
+/**
+ * @brief                   Locks the mutex if it is unlocked
+ *
+ * @param[in,out] state     lock word
+ *
+ * @return                  Bool indicating whether the mutex was locked
+ */
+bool MutexState_TryLock(struct MutexState *const state);
+
+/**
+ * @brief                   Marks the mutex as contended and locks it if it
+ *                          is unlocked. A thread which locks the mutex
+ *                          here keeps the mark, because other threads may
+ *                          still be waiting. If the mutex is not locked,
+ *                          the caller shall suspend until it is woken and
+ *                          then call the function again.
+ *
+ * @param[in,out] state     lock word
+ *
+ * @return                  Bool indicating whether the mutex was locked
+ */
+bool MutexState_LockContended(struct MutexState *const state);
+
+/**
+ * @brief                   Unlocks the mutex
+ *
+ * @param[in,out] state     lock word of a locked mutex
+ *
+ * @return                  Bool indicating whether the mutex was contended,
+ *                          in which case the caller shall wake one waiting
+ *                          thread
+ */
+bool MutexState_Unlock(struct MutexState *const state);
+
+#endif
@@ -0,0 +1,93 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TimeConversion.h"
+
+#define FRACTIONAL_BITS 32u
+#define LOWER_WORD_MASK 0xFFFFFFFFull
+
+static bool compute_factor(struct TimeConversion_Factor *const factor,
+			   const uint64_t numerator, const uint64_t denominator)
+{
+	const uint64_t integer_part = numerator / denominator;
+	if (integer_part > UINT32_MAX) {
+		return false;
+	}
+
+	// The remainder is smaller than the denominator, which is at most
+	// a few GHz, so shifting it by 32 bits cannot overflow.
+	const uint64_t remainder = numerator % denominator;
+	const uint64_t fractional_part =
+		((remainder << FRACTIONAL_BITS) + (denominator / 2u)) /
+		denominator;
+
+	if (fractional_part > UINT32_MAX) {
+		// Rounding carried into the integer part
+		factor->integer_part = (uint32_t)integer_part + 1u;
+		factor->fractional_part = 0u;
+	} else {
+		factor->integer_part = (uint32_t)integer_part;
+		factor->fractional_part = (uint32_t)fractional_part;
+	}
+
+	return true;
+}
+
+bool TimeConversion_Init(struct TimeConversion *const conversion,
+			 const uint64_t frequency)
+{
+	if (frequency == 0u || frequency > UINT32_MAX) {
+		return false;
+	}
+
+	conversion->frequency = frequency;
+
+	return compute_factor(&conversion->ticks_to_ns,
+			      TIME_CONVERSION_NANOSECONDS_IN_SECOND,
+			      frequency) &&
+	       compute_factor(&conversion->ns_to_ticks, frequency,
+			      TIME_CONVERSION_NANOSECONDS_IN_SECOND);
+}
+
+uint64_t TimeConversion_Apply(const struct TimeConversion_Factor *const factor,
+			      const uint64_t value)
+{
+	// value * fractional_part is a 96-bit product, it is split into
+	// two 32x32->64 multiplications so that only the bits above the
+	// binary point are kept:
+	// (high * 2^32 + low) * f / 2^32 = high * f + (low * f) / 2^32
+	const uint64_t high = value >> FRACTIONAL_BITS;
+	const uint64_t low = value & LOWER_WORD_MASK;
+
+	return value * factor->integer_part +
+	       high * factor->fractional_part +
+	       ((low * factor->fractional_part) >> FRACTIONAL_BITS);
+}
+
+uint64_t TimeConversion_TicksToNs(const struct TimeConversion *const conversion,
+				  const uint64_t ticks)
+{
+	return TimeConversion_Apply(&conversion->ticks_to_ns, ticks);
+}
+
+uint64_t TimeConversion_NsToTicks(const struct TimeConversion *const conversion,
+				  const uint64_t time_ns)
+{
+	return TimeConversion_Apply(&conversion->ns_to_ticks, time_ns);
+}
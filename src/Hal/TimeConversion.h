@@ -0,0 +1,111 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMECONVERSION_H
+#define TIMECONVERSION_H
+
+/**
+ * @file    TimeConversion.h
+ * @brief   Integer-only conversion between timer ticks and nanoseconds.
+ *
+ * The conversion ratio is split into an integer part and a 0.32 fixed-point
+ * fractional part, both computed once during initialization. Conversion
+ * itself uses only 32x32->64 multiplications, shifts and additions, so it
+ * does not require the FPU nor a runtime division.
+ *
+ * The fractional part is rounded to nearest and the product is truncated,
+ * so for an input value v and an exact ratio r the result x satisfies
+ * |x - v * r| < 1 + v / 2^33. The result may therefore be above v * r as
+ * well as below it. E.g. for an 18.75 MHz timer the error of the ticks to
+ * nanoseconds conversion stays below 9 ns after an hour of uptime.
+ * The module does not depend on RTEMS nor on the BSP.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TIME_CONVERSION_NANOSECONDS_IN_SECOND 1000000000ull
+
+/**
+ * @brief   Struct representing a precomputed ratio used to rescale values
+ */
+struct TimeConversion_Factor {
+	uint32_t integer_part;
+	uint32_t fractional_part;
+};
+
+/**
+ * @brief   Struct representing conversions between ticks of a timer running
+ *          at the given frequency and nanoseconds
+ */
+struct TimeConversion {
+	uint64_t frequency;
+	struct TimeConversion_Factor ticks_to_ns;
+	struct TimeConversion_Factor ns_to_ticks;
+};
+
+/**
+ * @brief                   Precomputes conversion factors for a timer
+ *
+ * @param[out] conversion   conversion to initialize
+ * @param[in] frequency     timer frequency in Hz
+ *
+ * @return                  Bool indicating whether the initialization was
+ *                          successful
+ */
+bool TimeConversion_Init(struct TimeConversion *const conversion,
+			 const uint64_t frequency);
+
+/**
+ * @brief                   Rescales a value by the given factor
+ *
+ * @param[in] factor        precomputed factor
+ * @param[in] value         value to rescale
+ *
+ * @return                  Rescaled value, within the error bound given
+ *                          in the file description
+ */
+uint64_t TimeConversion_Apply(const struct TimeConversion_Factor *const factor,
+			      const uint64_t value);
+
+/**
+ * @brief                   Converts timer ticks into nanoseconds
+ *
+ * @param[in] conversion    initialized conversion
+ * @param[in] ticks         number of timer ticks
+ *
+ * @return                  Number of nanoseconds, within the error bound
+ *                          given in the file description
+ */
+uint64_t TimeConversion_TicksToNs(const struct TimeConversion *const conversion,
+				  const uint64_t ticks);
+
+/**
+ * @brief                   Converts nanoseconds into timer ticks
+ *
+ * @param[in] conversion    initialized conversion
+ * @param[in] time_ns       time in nanoseconds
+ *
+ * @return                  Number of timer ticks, within the error bound
+ *                          given in the file description
+ */
+uint64_t TimeConversion_NsToTicks(const struct TimeConversion *const conversion,
+				  const uint64_t time_ns);
+
+#endif
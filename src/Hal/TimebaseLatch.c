@@ -0,0 +1,89 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TimebaseLatch.c
+ * @brief   Extension of a free running 16-bit counter to 64 bits.
+ */
+
+#include "TimebaseLatch.h"
+
+static inline uint64_t
+extend(const struct TimebaseLatch_Snapshot *const snapshot,
+       const uint32_t counter)
+{
+	// Valid as long as less than one counter period elapsed since the
+	// snapshot was taken
+	const uint32_t elapsed = (counter - snapshot->last_counter) &
+				 TIMEBASE_LATCH_CHANNEL_MASK;
+	return (uint64_t)snapshot->reloads * TIMEBASE_LATCH_TICKS_PER_RELOAD +
+	       snapshot->last_counter + elapsed;
+}
+
+void TimebaseLatch_Init(struct TimebaseLatch *const latch)
+{
+	const struct TimebaseLatch_Snapshot initial_snapshot = {
+		.reloads = 0u,
+		.last_counter = 0u,
+	};
+	latch->sequence = 0u;
+	latch->snapshots[0] = initial_snapshot;
+	latch->snapshots[1] = initial_snapshot;
+}
+
+void TimebaseLatch_Update(struct TimebaseLatch *const latch,
+			  const uint32_t counter)
+{
+	// The writer is the only one modifying the sequence
+	const uint32_t sequence =
+		__atomic_load_n(&latch->sequence, __ATOMIC_RELAXED);
+	const uint64_t ticks = extend(&latch->snapshots[sequence & 1u],
+				      counter);
+	const struct TimebaseLatch_Snapshot snapshot = {
+		.reloads = (uint32_t)(ticks / TIMEBASE_LATCH_TICKS_PER_RELOAD),
+		.last_counter =
+			(uint32_t)(ticks % TIMEBASE_LATCH_TICKS_PER_RELOAD),
+	};
+
+	// While one copy is modified, readers use the other one
+	__atomic_fetch_add(&latch->sequence, 1u, __ATOMIC_RELEASE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	latch->snapshots[0] = snapshot;
+	__atomic_fetch_add(&latch->sequence, 1u, __ATOMIC_RELEASE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	latch->snapshots[1] = snapshot;
+}
+
+uint64_t TimebaseLatch_Read(const struct TimebaseLatch *const latch,
+			    const TimebaseLatch_CounterReader read_counter)
+{
+	uint32_t sequence;
+	struct TimebaseLatch_Snapshot snapshot;
+	uint32_t counter;
+
+	do {
+		sequence = __atomic_load_n(&latch->sequence, __ATOMIC_ACQUIRE);
+		snapshot = latch->snapshots[sequence & 1u];
+		counter = read_counter();
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while (sequence !=
+		 __atomic_load_n(&latch->sequence, __ATOMIC_ACQUIRE));
+
+	return extend(&snapshot, counter);
+}
@@ -0,0 +1,101 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMEBASELATCH_H
+#define TIMEBASELATCH_H
+
+/**
+ * @file    TimebaseLatch.h
+ * @brief   Extension of a free running 16-bit counter to 64 bits with a
+ *          snapshot refreshed by the counter interrupt.
+ *
+ * The snapshot is kept in two copies selected by the parity of a sequence
+ * counter, so the copy used by a reader is never modified during the read.
+ * There shall be a single writer, which shall update the latch at least
+ * twice per counter period. Readers are lock-free: a reader which preempted
+ * the writer completes in one pass, a reader preempted by the writer
+ * repeats the read. The module does not access the hardware.
+ */
+
+#include <stdint.h>
+
+#define TIMEBASE_LATCH_CHANNEL_MASK 0xFFFFu
+#define TIMEBASE_LATCH_TICKS_PER_RELOAD 65536u
+
+/**
+ * @brief   Counter value and number of its reloads at the time of the last
+ *          update
+ */
+struct TimebaseLatch_Snapshot {
+	uint32_t reloads;
+	uint32_t last_counter;
+};
+
+/**
+ * @brief   Struct representing the latch
+ */
+struct TimebaseLatch {
+	uint32_t sequence;
+	struct TimebaseLatch_Snapshot snapshots[2];
+};
+
+/**
+ * @brief   Function returning the current value of the counter
+ */
+typedef uint32_t (*TimebaseLatch_CounterReader)(void);
+
+/**
+ * @brief               Initializes the latch with zero ticks
+ *
+ * @param[in] latch     pointer to the latch
+ */
+void TimebaseLatch_Init(struct TimebaseLatch *const latch);
+
+/**
+ * @brief               Updates the snapshot, called by the single writer
+ *                      on the counter overflow and in the middle of the
+ *                      counter range
+ *
+ *                      The new snapshot is derived from the counter, so a
+ *                      late or merged update does not lose a reload.
+ *
+ * @param[in] latch     pointer to the latch
+ * @param[in] counter   current value of the counter
+ */
+void TimebaseLatch_Update(struct TimebaseLatch *const latch,
+			  const uint32_t counter);
+
+/**
+ * @brief                   Returns the extended value of the counter
+ *
+ *                          The counter is read together with the snapshot
+ *                          and the read is repeated when the writer updated
+ *                          the latch in the meantime, so a reader delayed
+ *                          between the reads never combines a stale
+ *                          snapshot with a newer counter value.
+ *
+ * @param[in] latch         pointer to the latch
+ * @param[in] read_counter  function returning the current counter value
+ *
+ * @return                  Number of ticks counted since initialization
+ */
+uint64_t TimebaseLatch_Read(const struct TimebaseLatch *const latch,
+			    const TimebaseLatch_CounterReader read_counter);
+
+#endif
@@ -0,0 +1,102 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TimerQueue.h"
+
+#include <stddef.h>
+
+void TimerQueue_Init(struct TimerQueue *const queue)
+{
+	queue->head = NULL;
+}
+
+void TimerQueue_InitEntry(struct TimerQueue_Entry *const entry,
+			  const TimerQueue_Callback callback, void *const arg)
+{
+	entry->next = NULL;
+	entry->deadline = 0u;
+	entry->callback = callback;
+	entry->arg = arg;
+	entry->is_queued = false;
+	entry->generation = 0u;
+}
+
+bool TimerQueue_Insert(struct TimerQueue *const queue,
+		       struct TimerQueue_Entry *const entry,
+		       const uint64_t deadline)
+{
+	TimerQueue_Remove(queue, entry);
+
+	entry->deadline = deadline;
+	entry->is_queued = true;
+	entry->generation++;
+
+	struct TimerQueue_Entry **position = &queue->head;
+	while (*position != NULL && (*position)->deadline <= deadline) {
+		position = &(*position)->next;
+	}
+
+	entry->next = *position;
+	*position = entry;
+
+	return queue->head == entry;
+}
+
+bool TimerQueue_Remove(struct TimerQueue *const queue,
+		       struct TimerQueue_Entry *const entry)
+{
+	if (!entry->is_queued) {
+		return false;
+	}
+
+	struct TimerQueue_Entry **position = &queue->head;
+	while (*position != NULL && *position != entry) {
+		position = &(*position)->next;
+	}
+
+	if (*position == entry) {
+		*position = entry->next;
+	}
+
+	entry->next = NULL;
+	entry->is_queued = false;
+
+	return true;
+}
+
+struct TimerQueue_Entry *TimerQueue_Peek(const struct TimerQueue *const queue)
+{
+	return queue->head;
+}
+
+struct TimerQueue_Entry *TimerQueue_PopExpired(struct TimerQueue *const queue,
+					       const uint64_t now)
+{
+	struct TimerQueue_Entry *const head = queue->head;
+
+	if (head == NULL || head->deadline > now) {
+		return NULL;
+	}
+
+	queue->head = head->next;
+	head->next = NULL;
+	head->is_queued = false;
+
+	return head;
+}
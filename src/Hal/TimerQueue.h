@@ -0,0 +1,133 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMERQUEUE_H
+#define TIMERQUEUE_H
+
+/**
+ * @file    TimerQueue.h
+ * @brief   Queue of deadlines sorted in ascending order, used to multiplex
+ *          many software timers onto a single hardware comparator.
+ *
+ * Entries are provided by the user, so the queue does not allocate memory.
+ * Entries with equal deadlines are kept in insertion order. The module does
+ * not access the hardware and does not synchronize concurrent callers,
+ * this is left to the user.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief   Typedef of function called when the deadline of an entry expires
+ *
+ * @param[in] arg           user argument of the entry
+ * @param[in] generation    generation of the entry when it was removed from
+ *                          the queue, if it differs from the current one,
+ *                          the entry was inserted again in the meantime
+ */
+typedef void (*TimerQueue_Callback)(void *arg, uint32_t generation);
+
+/**
+ * @brief   Struct representing a single deadline in the queue
+ */
+struct TimerQueue_Entry {
+	struct TimerQueue_Entry *next;
+	uint64_t deadline;
+	TimerQueue_Callback callback;
+	void *arg;
+	bool is_queued;
+	uint32_t generation;
+};
+
+/**
+ * @brief   Struct representing the queue
+ */
+struct TimerQueue {
+	struct TimerQueue_Entry *head;
+};
+
+/**
+ * @brief                   Initializes an empty queue
+ *
+ * @param[out] queue        queue to initialize
+ */
+void TimerQueue_Init(struct TimerQueue *const queue);
+
+/**
+ * @brief                   Initializes an entry, which is not queued
+ *
+ * @param[out] entry        entry to initialize
+ * @param[in] callback      function called when the deadline expires
+ * @param[in] arg           argument passed to the callback
+ */
+void TimerQueue_InitEntry(struct TimerQueue_Entry *const entry,
+			  const TimerQueue_Callback callback, void *const arg);
+
+/**
+ * @brief                   Inserts the entry into the queue. If the entry
+ *                          is already queued, it is moved to the new
+ *                          position. The generation of the entry is
+ *                          incremented.
+ *
+ * @param[in,out] queue     queue
+ * @param[in,out] entry     entry to insert
+ * @param[in] deadline      deadline of the entry
+ *
+ * @return                  Bool indicating whether the entry became the
+ *                          head of the queue
+ */
+bool TimerQueue_Insert(struct TimerQueue *const queue,
+		       struct TimerQueue_Entry *const entry,
+		       const uint64_t deadline);
+
+/**
+ * @brief                   Removes the entry from the queue
+ *
+ * @param[in,out] queue     queue
+ * @param[in,out] entry     entry to remove
+ *
+ * @return                  Bool indicating whether the entry was queued
+ */
+bool TimerQueue_Remove(struct TimerQueue *const queue,
+		       struct TimerQueue_Entry *const entry);
+
+/**
+ * @brief                   Returns the entry with the earliest deadline
+ *
+ * @param[in] queue         queue
+ *
+ * @return                  Head of the queue or NULL if the queue is empty
+ */
+struct TimerQueue_Entry *
+TimerQueue_Peek(const struct TimerQueue *const queue);
+
+/**
+ * @brief                   Removes and returns the head of the queue if its
+ *                          deadline has expired
+ *
+ * @param[in,out] queue     queue
+ * @param[in] now           current time
+ *
+ * @return                  Expired entry or NULL if there is none
+ */
+struct TimerQueue_Entry *TimerQueue_PopExpired(struct TimerQueue *const queue,
+					       const uint64_t now);
+
+#endif
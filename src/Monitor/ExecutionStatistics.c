@@ -0,0 +1,144 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExecutionStatistics.h"
+
+static void add_square(struct ExecutionStatistics_Uint128 *const sum,
+		       const uint64_t value)
+{
+	// 64 x 64 bit multiplication from 32-bit halves, so it uses only
+	// integer multiply-accumulate instructions
+	const uint64_t low_half = value & 0xFFFFFFFFu;
+	const uint64_t high_half = value >> 32u;
+	const uint64_t low_product = low_half * low_half;
+	const uint64_t middle_product = low_half * high_half;
+	const uint64_t high_product = high_half * high_half;
+
+	// The middle product appears twice, the sum of its low part and the
+	// carry from the low product fits in 64 bits
+	const uint64_t middle_sum = (low_product >> 32u) +
+				    ((middle_product & 0xFFFFFFFFu) << 1u);
+	const uint64_t square_low =
+		(middle_sum << 32u) | (low_product & 0xFFFFFFFFu);
+	const uint64_t square_high =
+		high_product + ((middle_product >> 32u) << 1u) +
+		(middle_sum >> 32u);
+
+	sum->low += square_low;
+	sum->high += square_high + (sum->low < square_low ? 1u : 0u);
+}
+
+static double to_double(const struct ExecutionStatistics_Uint128 *const value)
+{
+	return (double)value->high * 18446744073709551616.0 +
+	       (double)value->low;
+}
+
+void ExecutionStatistics_Init(struct ExecutionStatistics *const statistics)
+{
+	statistics->sequence = 0u;
+	statistics->samples_count = 0u;
+	statistics->minimum = 0u;
+	statistics->maximum = 0u;
+	statistics->shift = 0u;
+	statistics->shifted_sum = 0;
+	statistics->shifted_sum_of_squares.high = 0u;
+	statistics->shifted_sum_of_squares.low = 0u;
+}
+
+void ExecutionStatistics_Add(struct ExecutionStatistics *const statistics,
+			     const uint64_t sample)
+{
+	// Odd sequence marks an update in progress
+	__atomic_fetch_add(&statistics->sequence, 1u, __ATOMIC_ACQ_REL);
+
+	if (statistics->samples_count == 0u) {
+		statistics->shift = sample;
+		statistics->minimum = sample;
+		statistics->maximum = sample;
+	} else if (sample < statistics->minimum) {
+		statistics->minimum = sample;
+	} else if (sample > statistics->maximum) {
+		statistics->maximum = sample;
+	}
+
+	const bool is_above = sample >= statistics->shift;
+	const uint64_t deviation = is_above ? sample - statistics->shift :
+					      statistics->shift - sample;
+	statistics->shifted_sum += is_above ? (int64_t)deviation :
+					      -(int64_t)deviation;
+	add_square(&statistics->shifted_sum_of_squares, deviation);
+	statistics->samples_count++;
+
+	__atomic_fetch_add(&statistics->sequence, 1u, __ATOMIC_ACQ_REL);
+}
+
+void ExecutionStatistics_Compute(
+	const struct ExecutionStatistics *const statistics,
+	struct ExecutionStatistics_Summary *const summary)
+{
+	uint32_t sequence;
+	uint32_t samples_count;
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t shift;
+	int64_t shifted_sum;
+	struct ExecutionStatistics_Uint128 shifted_sum_of_squares;
+
+	do {
+		sequence =
+			__atomic_load_n(&statistics->sequence, __ATOMIC_ACQUIRE);
+		samples_count = statistics->samples_count;
+		minimum = statistics->minimum;
+		maximum = statistics->maximum;
+		shift = statistics->shift;
+		shifted_sum = statistics->shifted_sum;
+		shifted_sum_of_squares = statistics->shifted_sum_of_squares;
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while ((sequence & 1u) != 0u ||
+		 sequence != __atomic_load_n(&statistics->sequence,
+					     __ATOMIC_ACQUIRE));
+
+	summary->samples_count = samples_count;
+	summary->minimum = minimum;
+	summary->maximum = maximum;
+	if (samples_count == 0u) {
+		summary->mean = 0u;
+		summary->variance = 0u;
+		return;
+	}
+
+	// Rounded toward minus infinity, the shifted mean is never below
+	// the negated shift, as no sample is negative
+	int64_t shifted_mean = shifted_sum / (int64_t)samples_count;
+	if (shifted_sum % (int64_t)samples_count < 0) {
+		shifted_mean--;
+	}
+	summary->mean = shift + (uint64_t)shifted_mean;
+
+	// Both terms are of the order of the sum of squared deviations from
+	// the mean, so the subtraction does not cancel
+	const double count = (double)samples_count;
+	const double sum = (double)shifted_sum;
+	const double squared_deviations =
+		to_double(&shifted_sum_of_squares) - sum * sum / count;
+	summary->variance = squared_deviations > 0.0 ?
+				    (uint64_t)(squared_deviations / count) :
+				    0u;
+}
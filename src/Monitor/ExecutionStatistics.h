@@ -0,0 +1,100 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EXECUTIONSTATISTICS_H
+#define EXECUTIONSTATISTICS_H
+
+/**
+ * @file    ExecutionStatistics.h
+ * @brief   Integer statistics of execution times, updated without floating
+ *          point operations.
+ *
+ * Samples are accumulated relative to the first sample, which keeps the sums
+ * small when the samples are close to each other, and lets the variance be
+ * computed without cancellation. The sum of squares is kept in 128 bits, so
+ * it cannot overflow in practice. The statistics have a single writer, and
+ * can be read from any thread with a sequence counter.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief   Struct representing unsigned 128-bit integer
+ */
+struct ExecutionStatistics_Uint128 {
+	uint64_t high;
+	uint64_t low;
+};
+
+/**
+ * @brief   Struct representing accumulated statistics
+ */
+struct ExecutionStatistics {
+	uint32_t sequence;
+	uint32_t samples_count;
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t shift;
+	int64_t shifted_sum;
+	struct ExecutionStatistics_Uint128 shifted_sum_of_squares;
+};
+
+/**
+ * @brief   Struct representing statistics derived from the accumulated ones,
+ *          all values are 0 if there are no samples
+ */
+struct ExecutionStatistics_Summary {
+	uint32_t samples_count;
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t mean;
+	uint64_t variance;
+};
+
+/**
+ * @brief                   Initializes empty statistics
+ *
+ * @param[out] statistics   statistics to initialize
+ */
+void ExecutionStatistics_Init(struct ExecutionStatistics *const statistics);
+
+/**
+ * @brief                   Adds a sample, called only by the single writer
+ *
+ * @param[in,out] statistics    statistics
+ * @param[in] sample        sample to add
+ */
+void ExecutionStatistics_Add(struct ExecutionStatistics *const statistics,
+			     const uint64_t sample);
+
+/**
+ * @brief                   Computes the summary of the added samples, the
+ *                          mean and the population variance are rounded
+ *                          down. Intended to be called outside of time
+ *                          critical paths.
+ *
+ * @param[in] statistics    statistics
+ * @param[out] summary      summary of the samples
+ */
+void ExecutionStatistics_Compute(
+	const struct ExecutionStatistics *const statistics,
+	struct ExecutionStatistics_Summary *const summary);
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <Monitor.h>
 #include <Hal.h>
+#include "ExecutionStatistics.h"
 #include <string.h>
 #include <rtems/score/cpu.h>
 
@@ -28,16 +29,34 @@
 extern const uint32_t log_buffer_start;
 extern const uint32_t log_buffer_end;
 
+#ifdef RT_EXEC_LOG_COMPACT
+#define RT_EXEC_LOG_ENTRY struct Monitor_CompactActivationEntry
+#else
+#define RT_EXEC_LOG_ENTRY struct Monitor_InterfaceActivationEntry
+#endif
+
+_Static_assert(sizeof(struct Monitor_InterfaceActivationEntry) == 16u,
+	       "activation entries are sized for the LOG memory region");
+
 #define RT_EXEC_LOG_BUFFER_SIZE \
     (((uint32_t)&log_buffer_end - (uint32_t)&log_buffer_start) \
-    / sizeof(struct Monitor_InterfaceActivationEntry))
+    / sizeof(RT_EXEC_LOG_ENTRY))
 
 static volatile bool is_frozen = true;
 static uint64_t activation_entry_counter = 0;
 
 __attribute__((section(".logsection"), aligned(RT_EXEC_LOG_BUFFER_ALIGNMENT)))
-static struct Monitor_InterfaceActivationEntry *const activation_log_buffer = 
-	(struct Monitor_InterfaceActivationEntry *const)&log_buffer_start;
+static RT_EXEC_LOG_ENTRY *const activation_log_buffer = 
+	(RT_EXEC_LOG_ENTRY *const)&log_buffer_start;
+
+#ifdef RT_EXEC_LOG_COMPACT
+_Static_assert(RUNTIME_THREAD_COUNT <=
+		       MONITOR_COMPACT_ENTRY_INTERFACE_MASK + 1u,
+	       "interfaces do not fit in compact activation records");
+
+// Bits 32-63 of the timestamp of the latest record
+static uint32_t log_ticks_high = 0;
+#endif
 #endif
 
 #define STACK_BYTE_PATTERN (uint32_t)0xA5A5A5A5
@@ -46,6 +65,48 @@ static uint32_t benchmarking_ticks = 0;
 static Timestamp_Control uptime_at_last_reset = 0;
 static Timestamp_Control total_usage_time = 0;
 static struct Monitor_CPUUsageData idle_cpu_usage_data;
+static uint64_t idle_time_at_last_reset = 0;
+static uint64_t elapsed_time_at_last_reset = 0;
+
+struct TimeAccumulator {
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t sum;
+};
+
+struct InterfaceTiming {
+	uint32_t activations_count;
+	struct TimeAccumulator release_jitter;
+	struct TimeAccumulator start_latency;
+	struct TimeAccumulator response_time;
+	uint64_t deadline;
+	uint64_t period;
+	uint32_t deadline_misses_count;
+	uint32_t coalesced_releases_count;
+};
+
+static struct InterfaceTiming interfaces_timing[RUNTIME_THREAD_COUNT];
+static struct ExecutionStatistics execution_statistics[RUNTIME_THREAD_COUNT];
+static struct ExecutionStatistics cpu_time_statistics[RUNTIME_THREAD_COUNT];
+static struct ExecutionStatistics
+	interference_time_statistics[RUNTIME_THREAD_COUNT];
+static rtems_id interfaces_period_id[RUNTIME_THREAD_COUNT];
+static uint32_t queued_items[RUNTIME_THREAD_COUNT];
+static uint32_t lane_queued_items[RUNTIME_THREAD_COUNT][RT_MAX_REQUEST_LANES];
+static uint32_t maximum_lane_queued_items[RUNTIME_THREAD_COUNT]
+					 [RT_MAX_REQUEST_LANES];
+static bool is_runtime_queue_created[RUNTIME_THREAD_COUNT];
+
+struct InterfaceOverflow {
+	uint32_t dropped_requests_count;
+	uint32_t unreported_dropped_requests_count;
+	uint64_t first_unreported_drop_time;
+	uint64_t last_drop_time;
+};
+
+static struct InterfaceOverflow interfaces_overflow[RUNTIME_THREAD_COUNT];
+static enum Monitor_OverflowReportingMode overflow_reporting_mode =
+	Monitor_OverflowReportingMode_Immediate;
 
 struct Monitor_MaximumStackUsageData {
 	enum interfaces_enum interface;
@@ -54,10 +115,60 @@ struct Monitor_MaximumStackUsageData {
 };
 
 Monitor_MessageQueueOverflow Monitor_MessageQueueOverflowCallback;
+Monitor_DeadlineMiss Monitor_DeadlineMissCallback;
+Monitor_BudgetOverrun Monitor_BudgetOverrunCallback;
+
+static uint32_t budget_overruns_count[RUNTIME_THREAD_COUNT];
+
+#if defined(RT_EXEC_LOG_ACTIVE) && defined(RT_EXEC_LOG_COMPACT)
+static void store_compact_entry(const enum interfaces_enum interface,
+				const enum Monitor_EntryType entry_type,
+				const uint32_t requests_count)
+{
+	const uint32_t saturated_requests_count =
+		requests_count > MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_MASK ?
+			MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_MASK :
+			requests_count;
+
+	// The timestamp is taken with the record reserved, so the records
+	// are ordered by their timestamps and the delta is never negative
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const uint64_t ticks = Hal_GetElapsedTicks();
+	const uint32_t ticks_high = (uint32_t)(ticks >> 32u);
+	if (ticks_high != log_ticks_high) {
+		// The previous bits let the records before the sync record be
+		// decoded when older sync records are overwritten
+		RT_EXEC_LOG_ENTRY *const sync_entry =
+			&activation_log_buffer[activation_entry_counter %
+					       RT_EXEC_LOG_BUFFER_SIZE];
+		sync_entry->header =
+			MONITOR_COMPACT_ENTRY_TYPE_SYNC |
+			(ticks_high << MONITOR_COMPACT_ENTRY_SYNC_TICKS_SHIFT);
+		sync_entry->ticks = log_ticks_high;
+		log_ticks_high = ticks_high;
+		activation_entry_counter++;
+	}
+
+	RT_EXEC_LOG_ENTRY *const entry =
+		&activation_log_buffer[activation_entry_counter %
+				       RT_EXEC_LOG_BUFFER_SIZE];
+	entry->header =
+		((uint32_t)entry_type & MONITOR_COMPACT_ENTRY_TYPE_MASK) |
+		(((uint32_t)interface & MONITOR_COMPACT_ENTRY_INTERFACE_MASK)
+		 << MONITOR_COMPACT_ENTRY_INTERFACE_SHIFT) |
+		(saturated_requests_count
+		 << MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_SHIFT);
+	entry->ticks = (uint32_t)ticks;
+	activation_entry_counter++;
+	rtems_interrupt_local_enable(level);
+}
+#endif
 
 static bool
 handle_activation_log_cyclic_buffer(const enum interfaces_enum interface,
-				    const enum Monitor_EntryType entry_type)
+				    const enum Monitor_EntryType entry_type,
+				    const uint32_t requests_count)
 {
 #ifndef RT_EXEC_LOG_ACTIVE
 	return false;
@@ -66,18 +177,91 @@ handle_activation_log_cyclic_buffer(const enum interfaces_enum interface,
 		return false;
 	}
 
-	activation_log_buffer[activation_entry_counter % RT_EXEC_LOG_BUFFER_SIZE]
-		.interface = interface;
-	activation_log_buffer[activation_entry_counter % RT_EXEC_LOG_BUFFER_SIZE]
-		.entry_type = entry_type;
-	activation_log_buffer[activation_entry_counter % RT_EXEC_LOG_BUFFER_SIZE]
-		.timestamp = Hal_GetElapsedTimeInNs();
-	activation_entry_counter++;
+#ifdef RT_EXEC_LOG_COMPACT
+	store_compact_entry(interface, entry_type, requests_count);
+#else
+	// Entries are also stored from interrupt handlers, so the entry is
+	// reserved with interrupts disabled
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const uint64_t entry_index = activation_entry_counter++;
+	rtems_interrupt_local_enable(level);
+
+	activation_log_buffer[entry_index % RT_EXEC_LOG_BUFFER_SIZE].interface =
+		(uint16_t)interface;
+	activation_log_buffer[entry_index % RT_EXEC_LOG_BUFFER_SIZE]
+		.entry_type = (uint16_t)entry_type;
+	activation_log_buffer[entry_index % RT_EXEC_LOG_BUFFER_SIZE].timestamp =
+		Hal_GetElapsedTimeInNs();
+	activation_log_buffer[entry_index % RT_EXEC_LOG_BUFFER_SIZE]
+		.requests_count = requests_count;
+#endif
 
 	return true;
 #endif
 }
 
+static void update_idle_cpu_usage_data(const float usage_percent)
+{
+	if (usage_percent < idle_cpu_usage_data.minimum_cpu_usage) {
+		idle_cpu_usage_data.minimum_cpu_usage = usage_percent;
+	}
+
+	if (usage_percent > idle_cpu_usage_data.maximum_cpu_usage) {
+		idle_cpu_usage_data.maximum_cpu_usage = usage_percent;
+	}
+
+	idle_cpu_usage_data.average_cpu_usage =
+		idle_cpu_usage_data.average_cpu_usage +
+		(usage_percent - idle_cpu_usage_data.average_cpu_usage) /
+			(benchmarking_ticks + 1);
+}
+
+static void accumulate_time(struct TimeAccumulator *const accumulator,
+			    const uint64_t time, const bool is_first)
+{
+	if (is_first || time < accumulator->minimum) {
+		accumulator->minimum = time;
+	}
+
+	if (is_first || time > accumulator->maximum) {
+		accumulator->maximum = time;
+	}
+
+	accumulator->sum += time;
+}
+
+static void get_time_statistics(const struct TimeAccumulator *const accumulator,
+				const uint32_t count,
+				struct Monitor_TimeStatistics *const statistics)
+{
+	statistics->minimum = accumulator->minimum;
+	statistics->maximum = accumulator->maximum;
+	statistics->average = count > 0u ? accumulator->sum / count : 0u;
+}
+
+static inline uint64_t timespec_to_ns(const struct timespec *const time)
+{
+	return (uint64_t)time->tv_sec * 1000000000u + (uint64_t)time->tv_nsec;
+}
+
+static void
+get_period_time_statistics(const struct timespec *const minimum,
+			   const struct timespec *const maximum,
+			   const struct timespec *const total,
+			   const uint32_t count,
+			   struct Monitor_TimeStatistics *const statistics)
+{
+	statistics->minimum = count > 0u ? timespec_to_ns(minimum) : 0u;
+	statistics->maximum = timespec_to_ns(maximum);
+	statistics->average = count > 0u ? timespec_to_ns(total) / count : 0u;
+}
+
+static inline uint64_t time_since(const uint64_t time, const uint64_t origin)
+{
+	return time > origin ? time - origin : 0u;
+}
+
 static bool cpu_usage_visitor(Thread_Control *the_thread, void *arg)
 {
 	float usage_percent;
@@ -95,18 +279,7 @@ static bool cpu_usage_visitor(Thread_Control *the_thread, void *arg)
 	usage_percent = (float)float_val / TOD_NANOSECONDS_PER_MICROSECOND;
 	usage_percent += (float)integer_val;
 
-	if (usage_percent < idle_cpu_usage_data.minimum_cpu_usage) {
-		idle_cpu_usage_data.minimum_cpu_usage = usage_percent;
-	}
-
-	if (usage_percent > idle_cpu_usage_data.maximum_cpu_usage) {
-		idle_cpu_usage_data.maximum_cpu_usage = usage_percent;
-	}
-
-	idle_cpu_usage_data.average_cpu_usage =
-		idle_cpu_usage_data.average_cpu_usage +
-		(usage_percent - idle_cpu_usage_data.average_cpu_usage) /
-			(benchmarking_ticks + 1);
+	update_idle_cpu_usage_data(usage_percent);
 
 	// only first idle thread is needed, stop iteration after first step
 	return true;
@@ -189,18 +362,80 @@ bool Monitor_Init()
 	rtems_cpu_usage_reset();
 	_TOD_Get_uptime(&uptime_at_last_reset);
 
+	elapsed_time_at_last_reset = Hal_GetElapsedTimeInNs();
+	if (!Hal_GetIdleTimeInNs(&idle_time_at_last_reset)) {
+		idle_time_at_last_reset = 0;
+	}
+
 	for (int i = 0; i < RUNTIME_THREAD_COUNT; i++) {
 		maximum_queued_items[i] = 0;
+		ExecutionStatistics_Init(&execution_statistics[i]);
+		ExecutionStatistics_Init(&cpu_time_statistics[i]);
+		ExecutionStatistics_Init(&interference_time_statistics[i]);
+		for (int lane = 0; lane < RT_MAX_REQUEST_LANES; lane++) {
+			maximum_lane_queued_items[i][lane] = 0;
+		}
 	}
 
 	return true;
 }
 
+static uint32_t take_unreported_drops(const enum interfaces_enum interface)
+{
+	struct InterfaceOverflow *const overflow =
+		&interfaces_overflow[interface];
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	const uint32_t count = overflow->unreported_dropped_requests_count;
+	overflow->unreported_dropped_requests_count = 0u;
+	overflow->first_unreported_drop_time = 0u;
+	rtems_interrupt_local_enable(level);
+
+	return count;
+}
+
+static void report_dropped_requests(void)
+{
+	const Monitor_MessageQueueOverflow callback =
+		Monitor_MessageQueueOverflowCallback;
+	if (callback == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < RUNTIME_THREAD_COUNT; i++) {
+		const uint32_t count =
+			take_unreported_drops((const enum interfaces_enum)i);
+		if (count > 0u) {
+			callback((const enum interfaces_enum)i, count);
+		}
+	}
+}
+
 bool Monitor_MonitoringTick(void)
 {
-	// update information about cpu usage
-	rtems_task_iterate(cpu_usage_visitor, NULL);
+	// update information about cpu usage, prefer the accounting done
+	// by Hal_IdleTask, which excludes time spent in interrupt handlers
+	uint64_t idle_time;
+	if (Hal_GetIdleTimeInNs(&idle_time)) {
+		const uint64_t elapsed_time =
+			Hal_GetElapsedTimeInNs() - elapsed_time_at_last_reset;
+		idle_time -= idle_time_at_last_reset;
+
+		if (elapsed_time > 0) {
+			update_idle_cpu_usage_data((float)idle_time * 100.0f /
+						   (float)elapsed_time);
+		}
+	} else {
+		rtems_task_iterate(cpu_usage_visitor, NULL);
+	}
 	benchmarking_ticks++;
+
+	if (overflow_reporting_mode == Monitor_OverflowReportingMode_Deferred) {
+		report_dropped_requests();
+	}
+
+	return true;
 }
 
 bool Monitor_GetUsageData(const enum interfaces_enum interface,
@@ -211,8 +446,208 @@ bool Monitor_GetUsageData(const enum interfaces_enum interface,
 		threads_info[interface].max_thread_execution_time;
 	usage_data->minimum_execution_time =
 		threads_info[interface].min_thread_execution_time;
-	usage_data->average_execution_time =
-		(uint64_t)threads_info[interface].mean_thread_execution_time;
+
+	struct ExecutionStatistics_Summary summary;
+	ExecutionStatistics_Compute(&execution_statistics[interface], &summary);
+	usage_data->average_execution_time = summary.mean;
+	usage_data->execution_time_variance = summary.variance;
+	// Kept for the users of threads_info, the activation path no longer
+	// updates it
+	threads_info[interface].mean_thread_execution_time =
+		(double)summary.mean;
+
+	ExecutionStatistics_Compute(&cpu_time_statistics[interface], &summary);
+	usage_data->maximum_cpu_time = summary.maximum;
+	usage_data->minimum_cpu_time = summary.minimum;
+	usage_data->average_cpu_time = summary.mean;
+
+	ExecutionStatistics_Compute(&interference_time_statistics[interface],
+				    &summary);
+	usage_data->maximum_interference_time = summary.maximum;
+	usage_data->average_interference_time = summary.mean;
+	return true;
+}
+
+bool Monitor_IndicateInterfaceExecutionTime(
+	const enum interfaces_enum interface, const uint64_t execution_time,
+	const uint64_t cpu_time)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	ExecutionStatistics_Add(&execution_statistics[interface],
+				execution_time);
+	ExecutionStatistics_Add(&cpu_time_statistics[interface], cpu_time);
+	// Both times are measured with different clocks, so the CPU time can
+	// slightly exceed the wall time
+	ExecutionStatistics_Add(&interference_time_statistics[interface],
+				execution_time > cpu_time ?
+					execution_time - cpu_time :
+					0u);
+	return true;
+}
+
+bool Monitor_GetInterfaceTimingData(
+	const enum interfaces_enum interface,
+	struct Monitor_InterfaceTimingData *const timing_data)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	const struct InterfaceTiming *const timing =
+		&interfaces_timing[interface];
+
+	timing_data->interface = interface;
+	timing_data->activations_count = timing->activations_count;
+	get_time_statistics(&timing->release_jitter, timing->activations_count,
+			    &timing_data->release_jitter);
+	get_time_statistics(&timing->start_latency, timing->activations_count,
+			    &timing_data->start_latency);
+	get_time_statistics(&timing->response_time, timing->activations_count,
+			    &timing_data->response_time);
+	timing_data->deadline =
+		timing->deadline != 0u ? timing->deadline : timing->period;
+	timing_data->deadline_misses_count = timing->deadline_misses_count;
+	timing_data->coalesced_releases_count =
+		timing->coalesced_releases_count;
+	return true;
+}
+
+bool Monitor_SetInterfaceDeadline(const enum interfaces_enum interface,
+				  const uint64_t deadline_ns)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	interfaces_timing[interface].deadline = deadline_ns;
+	return true;
+}
+
+bool Monitor_IndicatePeriodCreated(const enum interfaces_enum interface,
+				   const rtems_id period_id)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	interfaces_period_id[interface] = period_id;
+	return true;
+}
+
+bool Monitor_GetPeriodStatistics(
+	const enum interfaces_enum interface,
+	struct Monitor_PeriodStatistics *const statistics)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    interfaces_period_id[interface] == RTEMS_ID_NONE) {
+		return false;
+	}
+
+	rtems_rate_monotonic_period_statistics period_statistics;
+	if (rtems_rate_monotonic_get_statistics(interfaces_period_id[interface],
+						&period_statistics) !=
+	    RTEMS_SUCCESSFUL) {
+		return false;
+	}
+
+	statistics->interface = interface;
+	statistics->periods_count = period_statistics.count;
+	statistics->missed_periods_count = period_statistics.missed_count;
+	get_period_time_statistics(&period_statistics.min_cpu_time,
+				   &period_statistics.max_cpu_time,
+				   &period_statistics.total_cpu_time,
+				   period_statistics.count,
+				   &statistics->cpu_time);
+	get_period_time_statistics(&period_statistics.min_wall_time,
+				   &period_statistics.max_wall_time,
+				   &period_statistics.total_wall_time,
+				   period_statistics.count,
+				   &statistics->wall_time);
+	return true;
+}
+
+bool Monitor_SetDeadlineMissCallback(
+	Monitor_DeadlineMiss deadline_miss_callback)
+{
+	Monitor_DeadlineMissCallback = deadline_miss_callback;
+	return true;
+}
+
+bool Monitor_SetBudgetOverrunCallback(
+	Monitor_BudgetOverrun budget_overrun_callback)
+{
+	Monitor_BudgetOverrunCallback = budget_overrun_callback;
+	return true;
+}
+
+bool Monitor_IndicateReleasesCoalesced(const enum interfaces_enum interface,
+				       const uint32_t releases_count)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	interfaces_timing[interface].coalesced_releases_count += releases_count;
+	return true;
+}
+
+bool Monitor_IndicateCyclicActivationTiming(
+	const enum interfaces_enum interface, const uint64_t planned_release,
+	const uint64_t actual_release, const uint64_t start,
+	const uint64_t finish, const uint64_t period)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	struct InterfaceTiming *const timing = &interfaces_timing[interface];
+	const bool is_first = timing->activations_count == 0u;
+	const uint64_t response_time = time_since(finish, planned_release);
+
+	accumulate_time(&timing->release_jitter,
+			time_since(actual_release, planned_release), is_first);
+	accumulate_time(&timing->start_latency,
+			time_since(start, planned_release), is_first);
+	accumulate_time(&timing->response_time, response_time, is_first);
+	timing->period = period;
+	timing->activations_count++;
+
+	const uint64_t deadline =
+		timing->deadline != 0u ? timing->deadline : period;
+	if (response_time > deadline) {
+		timing->deadline_misses_count++;
+		if (Monitor_DeadlineMissCallback != NULL) {
+			Monitor_DeadlineMissCallback(interface, response_time);
+		}
+	}
+
+	return true;
+}
+
+bool Monitor_GetSemaphoreUsageData(
+	const int32_t semaphore_id,
+	struct Monitor_SemaphoreUsageData *const usage_data)
+{
+	struct Hal_SemaphoreStatistics statistics;
+	if (!Hal_SemaphoreGetStatistics(semaphore_id, &statistics)) {
+		return false;
+	}
+
+	usage_data->semaphore_id = semaphore_id;
+	usage_data->acquisitions_count = statistics.acquisitions_count;
+	usage_data->contended_acquisitions_count =
+		statistics.contended_acquisitions_count;
+	usage_data->total_wait_time = statistics.total_wait_time_ns;
+	usage_data->maximum_wait_time = statistics.maximum_wait_time_ns;
+	usage_data->average_wait_time =
+		statistics.contended_acquisitions_count > 0u ?
+			statistics.total_wait_time_ns /
+				statistics.contended_acquisitions_count :
+			0u;
+	usage_data->maximum_hold_time = statistics.maximum_hold_time_ns;
 	return true;
 }
 
@@ -250,37 +685,257 @@ bool Monitor_SetMessageQueueOverflowCallback(
 	return true;
 }
 
+bool Monitor_SetOverflowReportingMode(
+	const enum Monitor_OverflowReportingMode mode)
+{
+	if (mode != Monitor_OverflowReportingMode_Immediate &&
+	    mode != Monitor_OverflowReportingMode_Deferred) {
+		return false;
+	}
+
+	overflow_reporting_mode = mode;
+	return true;
+}
+
+bool Monitor_IndicateRequestsDropped(const enum interfaces_enum interface,
+				     const uint32_t requests_count)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	struct InterfaceOverflow *const overflow =
+		&interfaces_overflow[interface];
+	const uint64_t now = Hal_GetElapsedTimeInNs();
+
+	// Senders of any priority and interrupt handlers may drop requests
+	// concurrently, the record is kept consistent by disabling interrupts
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	if (overflow->unreported_dropped_requests_count == 0u) {
+		overflow->first_unreported_drop_time = now;
+	}
+	overflow->dropped_requests_count += requests_count;
+	overflow->unreported_dropped_requests_count += requests_count;
+	overflow->last_drop_time = now;
+	rtems_interrupt_local_enable(level);
+
+	const Monitor_MessageQueueOverflow callback =
+		Monitor_MessageQueueOverflowCallback;
+	if (callback == NULL) {
+		return false;
+	}
+
+	if (overflow_reporting_mode == Monitor_OverflowReportingMode_Immediate) {
+		const uint32_t count = take_unreported_drops(interface);
+		if (count > 0u) {
+			callback(interface, count);
+		}
+	}
+
+	return true;
+}
+
+bool Monitor_GetOverflowData(const enum interfaces_enum interface,
+			     struct Monitor_OverflowData *const overflow_data)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	const struct InterfaceOverflow *const overflow =
+		&interfaces_overflow[interface];
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	overflow_data->interface = interface;
+	overflow_data->dropped_requests_count = overflow->dropped_requests_count;
+	overflow_data->unreported_dropped_requests_count =
+		overflow->unreported_dropped_requests_count;
+	overflow_data->first_unreported_drop_time =
+		overflow->first_unreported_drop_time;
+	overflow_data->last_drop_time = overflow->last_drop_time;
+	rtems_interrupt_local_enable(level);
+
+	return true;
+}
+
 int32_t Monitor_GetQueuedItemsCount(const enum interfaces_enum interface)
 {
-	if (interface_to_queue_map[interface] == RTEMS_ID_NONE) {
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    (interface_to_queue_map[interface] == RTEMS_ID_NONE &&
+	     !is_runtime_queue_created[interface])) {
 		return -1;
 	}
 
-	uint32_t count;
-	if (rtems_message_queue_get_number_pending(
-		    interface_to_queue_map[interface], &count) !=
-	    RTEMS_SUCCESSFUL) {
+	return (int32_t)__atomic_load_n(&queued_items[interface],
+					__ATOMIC_RELAXED);
+}
+
+int32_t Monitor_GetMaximumQueuedItemsCount(const enum interfaces_enum interface)
+{
+	return (int32_t)__atomic_load_n(&maximum_queued_items[interface],
+					__ATOMIC_RELAXED);
+}
+
+bool Monitor_IndicateInterfaceQueueCreated(
+	const enum interfaces_enum interface)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	is_runtime_queue_created[interface] = true;
+	return true;
+}
+
+static void increment_queued_count(uint32_t *const count,
+				   uint32_t *const maximum_count)
+{
+	const uint32_t new_count =
+		__atomic_add_fetch(count, 1u, __ATOMIC_RELAXED);
+
+	// Lock-free high-water mark, retried only if another sender updated
+	// the mark in the meantime
+	uint32_t maximum = __atomic_load_n(maximum_count, __ATOMIC_RELAXED);
+	while (new_count > maximum &&
+	       !__atomic_compare_exchange_n(maximum_count, &maximum, new_count,
+					    true, __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED)) {
+	}
+}
+
+static bool decrement_queued_count(uint32_t *const count)
+{
+	// Saturates at 0, in case a request was queued outside the runtime
+	uint32_t current = __atomic_load_n(count, __ATOMIC_RELAXED);
+	do {
+		if (current == 0u) {
+			return false;
+		}
+	} while (!__atomic_compare_exchange_n(count, &current, current - 1u,
+					      true, __ATOMIC_RELAXED,
+					      __ATOMIC_RELAXED));
+
+	return true;
+}
+
+bool Monitor_IndicateRequestQueued(const enum interfaces_enum interface)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	increment_queued_count(&queued_items[interface],
+			       &maximum_queued_items[interface]);
+	return true;
+}
+
+bool Monitor_IndicateRequestDequeued(const enum interfaces_enum interface)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	return decrement_queued_count(&queued_items[interface]);
+}
+
+bool Monitor_IndicateLaneRequestQueued(const enum interfaces_enum interface,
+				       const uint32_t lane)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    lane >= RT_MAX_REQUEST_LANES) {
+		return false;
+	}
+
+	increment_queued_count(&lane_queued_items[interface][lane],
+			       &maximum_lane_queued_items[interface][lane]);
+	return true;
+}
+
+bool Monitor_IndicateLaneRequestDequeued(const enum interfaces_enum interface,
+					 const uint32_t lane)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    lane >= RT_MAX_REQUEST_LANES) {
+		return false;
+	}
+
+	return decrement_queued_count(&lane_queued_items[interface][lane]);
+}
+
+int32_t Monitor_GetLaneQueuedItemsCount(const enum interfaces_enum interface,
+					const uint32_t lane)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    lane >= RT_MAX_REQUEST_LANES) {
 		return -1;
 	}
 
-	return (int32_t)count;
+	return (int32_t)__atomic_load_n(&lane_queued_items[interface][lane],
+					__ATOMIC_RELAXED);
 }
 
-int32_t Monitor_GetMaximumQueuedItemsCount(const enum interfaces_enum interface)
+int32_t
+Monitor_GetMaximumLaneQueuedItemsCount(const enum interfaces_enum interface,
+				       const uint32_t lane)
 {
-	return maximum_queued_items[interface];
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT ||
+	    lane >= RT_MAX_REQUEST_LANES) {
+		return -1;
+	}
+
+	return (int32_t)__atomic_load_n(
+		&maximum_lane_queued_items[interface][lane], __ATOMIC_RELAXED);
 }
 
 bool Monitor_IndicateInterfaceActivated(const enum interfaces_enum interface)
 {
 	return handle_activation_log_cyclic_buffer(
-		interface, Monitor_EntryType_activation);
+		interface, Monitor_EntryType_activation, 1u);
 }
 
 bool Monitor_IndicateInterfaceDeactivated(const enum interfaces_enum interface)
 {
 	return handle_activation_log_cyclic_buffer(
-		interface, Monitor_EntryType_deactivation);
+		interface, Monitor_EntryType_deactivation, 1u);
+}
+
+bool Monitor_IndicateBudgetOverrun(const enum interfaces_enum interface,
+				   const uint64_t budget)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	__atomic_add_fetch(&budget_overruns_count[interface], 1u,
+			   __ATOMIC_RELAXED);
+	(void)handle_activation_log_cyclic_buffer(
+		interface, Monitor_EntryType_budget_overrun, 0u);
+
+	const Monitor_BudgetOverrun callback = Monitor_BudgetOverrunCallback;
+	if (callback != NULL) {
+		callback(interface, budget);
+	}
+
+	return true;
+}
+
+int32_t Monitor_GetBudgetOverrunsCount(const enum interfaces_enum interface)
+{
+	if ((uint32_t)interface >= RUNTIME_THREAD_COUNT) {
+		return -1;
+	}
+
+	return (int32_t)__atomic_load_n(&budget_overruns_count[interface],
+					__ATOMIC_RELAXED);
+}
+
+bool Monitor_IndicateInterfaceBatchDeactivated(
+	const enum interfaces_enum interface, const uint32_t requests_count)
+{
+	return handle_activation_log_cyclic_buffer(
+		interface, Monitor_EntryType_deactivation, requests_count);
 }
 
 bool Monitor_GetInterfaceActivationEntryLog(
@@ -288,7 +943,7 @@ bool Monitor_GetInterfaceActivationEntryLog(
 	uint32_t *out_latest_activation_entry_index,
 	uint32_t *out_size_of_activation_log)
 {
-#ifndef RT_EXEC_LOG_ACTIVE
+#if !defined(RT_EXEC_LOG_ACTIVE) || defined(RT_EXEC_LOG_COMPACT)
 	return false;
 #else
 	*activation_log = activation_log_buffer;
@@ -311,6 +966,96 @@ bool Monitor_GetInterfaceActivationEntryLog(
 #endif
 }
 
+bool Monitor_GetCompactActivationLog(
+	const struct Monitor_CompactActivationEntry **activation_log,
+	uint32_t *out_latest_activation_entry_index,
+	uint32_t *out_size_of_activation_log)
+{
+#if !defined(RT_EXEC_LOG_ACTIVE) || !defined(RT_EXEC_LOG_COMPACT)
+	return false;
+#else
+	*activation_log = activation_log_buffer;
+
+	if (activation_entry_counter == 0) {
+		*out_latest_activation_entry_index = 0;
+		*out_size_of_activation_log = 0;
+	} else {
+		*out_latest_activation_entry_index =
+			(activation_entry_counter - 1) %
+			RT_EXEC_LOG_BUFFER_SIZE;
+
+		if (activation_entry_counter > RT_EXEC_LOG_BUFFER_SIZE) {
+			*out_size_of_activation_log = RT_EXEC_LOG_BUFFER_SIZE;
+		} else {
+			*out_size_of_activation_log = activation_entry_counter;
+		}
+	}
+
+	return true;
+#endif
+}
+
+uint32_t Monitor_DecodeInterfaceActivationLog(
+	struct Monitor_InterfaceActivationEntry *const entries,
+	const uint32_t max_entries_count)
+{
+#if !defined(RT_EXEC_LOG_ACTIVE) || !defined(RT_EXEC_LOG_COMPACT)
+	return 0u;
+#else
+	const uint64_t entries_counter = activation_entry_counter;
+	const uint64_t oldest_index =
+		entries_counter > RT_EXEC_LOG_BUFFER_SIZE ?
+			entries_counter - RT_EXEC_LOG_BUFFER_SIZE :
+			0u;
+
+	// The oldest records share the bits of the oldest sync record which
+	// follows them, or of the latest record if there is none
+	uint32_t ticks_high = log_ticks_high;
+	for (uint64_t index = oldest_index; index < entries_counter; index++) {
+		const RT_EXEC_LOG_ENTRY *const record =
+			&activation_log_buffer[index % RT_EXEC_LOG_BUFFER_SIZE];
+		if ((record->header & MONITOR_COMPACT_ENTRY_TYPE_MASK) ==
+		    MONITOR_COMPACT_ENTRY_TYPE_SYNC) {
+			ticks_high = record->ticks;
+			break;
+		}
+	}
+
+	uint32_t entries_count = 0u;
+	for (uint64_t index = oldest_index;
+	     index < entries_counter && entries_count < max_entries_count;
+	     index++) {
+		const RT_EXEC_LOG_ENTRY *const record =
+			&activation_log_buffer[index % RT_EXEC_LOG_BUFFER_SIZE];
+		const uint32_t header = record->header;
+		const uint32_t entry_type =
+			header & MONITOR_COMPACT_ENTRY_TYPE_MASK;
+
+		if (entry_type == MONITOR_COMPACT_ENTRY_TYPE_SYNC) {
+			ticks_high = header >>
+				     MONITOR_COMPACT_ENTRY_SYNC_TICKS_SHIFT;
+		} else {
+			const uint32_t interface =
+				(header >>
+				 MONITOR_COMPACT_ENTRY_INTERFACE_SHIFT) &
+				MONITOR_COMPACT_ENTRY_INTERFACE_MASK;
+			struct Monitor_InterfaceActivationEntry *const entry =
+				&entries[entries_count++];
+			entry->interface = (uint16_t)interface;
+			entry->entry_type = (uint16_t)entry_type;
+			entry->timestamp =
+				Hal_TicksToNs(((uint64_t)ticks_high << 32u) |
+					      record->ticks);
+			entry->requests_count =
+				header >>
+				MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_SHIFT;
+		}
+	}
+
+	return entries_count;
+#endif
+}
+
 bool Monitor_FreezeInterfaceActivationLogging()
 {
 #ifndef RT_EXEC_LOG_ACTIVE
@@ -35,6 +35,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#ifndef RT_MAX_REQUEST_LANES
+#define RT_MAX_REQUEST_LANES 4
+#endif
+
 /**
  * @brief   Struct representing usage and benchmarking data for the given
  * interface
@@ -44,6 +48,86 @@ struct Monitor_InterfaceUsageData {
 	uint64_t maximum_execution_time;
 	uint64_t minimum_execution_time;
 	uint64_t average_execution_time;
+	uint64_t execution_time_variance;
+	uint64_t maximum_cpu_time;
+	uint64_t minimum_cpu_time;
+	uint64_t average_cpu_time;
+	uint64_t maximum_interference_time;
+	uint64_t average_interference_time;
+};
+
+/**
+ * @brief   Struct representing minimum, maximum and average of a time
+ *          measured on every activation, expressed in nanoseconds
+ */
+struct Monitor_TimeStatistics {
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t average;
+};
+
+/**
+ * @brief   Struct representing release and response timing data of the given
+ * cyclic interface. All times are measured from the planned release time.
+ */
+struct Monitor_InterfaceTimingData {
+	enum interfaces_enum interface;
+	uint32_t activations_count;
+	struct Monitor_TimeStatistics release_jitter;
+	struct Monitor_TimeStatistics start_latency;
+	struct Monitor_TimeStatistics response_time;
+	uint64_t deadline;
+	uint32_t deadline_misses_count;
+	uint32_t coalesced_releases_count;
+};
+
+/**
+ * @brief   Struct representing statistics of the RTEMS rate monotonic period
+ * releasing the given cyclic interface, all times are expressed in nanoseconds.
+ */
+struct Monitor_PeriodStatistics {
+	enum interfaces_enum interface;
+	uint32_t periods_count;
+	uint32_t missed_periods_count;
+	struct Monitor_TimeStatistics cpu_time;
+	struct Monitor_TimeStatistics wall_time;
+};
+
+/**
+ * @brief   Struct representing usage data of the given Hal semaphore
+ */
+struct Monitor_SemaphoreUsageData {
+	int32_t semaphore_id;
+	uint32_t acquisitions_count;
+	uint32_t contended_acquisitions_count;
+	uint64_t total_wait_time;
+	uint64_t maximum_wait_time;
+	uint64_t average_wait_time;
+	uint64_t maximum_hold_time;
+};
+
+/**
+ * @brief   Struct representing requests dropped because the queue of the
+ *          given interface was full. Times are expressed in nanoseconds from
+ *          the initialization of the runtime.
+ */
+struct Monitor_OverflowData {
+	enum interfaces_enum interface;
+	uint32_t dropped_requests_count;
+	uint32_t unreported_dropped_requests_count;
+	uint64_t first_unreported_drop_time;
+	uint64_t last_drop_time;
+};
+
+/**
+ * @brief   Enum representing when the message queue overflow callback is
+ *          called
+ */
+enum Monitor_OverflowReportingMode {
+	Monitor_OverflowReportingMode_Immediate =
+		0, ///< From the sender, on every overflow
+	Monitor_OverflowReportingMode_Deferred =
+		1, ///< From Monitor_MonitoringTick, once per interface
 };
 
 /**
@@ -60,18 +144,55 @@ struct Monitor_CPUUsageData {
  */
 enum Monitor_EntryType {
 	Monitor_EntryType_activation = 0,
-	Monitor_EntryType_deactivation = 1
+	Monitor_EntryType_deactivation = 1,
+	Monitor_EntryType_budget_overrun = 2
 };
 
 /**
- * @brief   Struct representing the interface activation entry
+ * @brief   Struct representing the interface activation entry. The interface
+ *          (enum interfaces_enum) and the entry type (enum Monitor_EntryType)
+ *          are stored in 16 bits each, so the entry keeps its size of 16
+ *          bytes and the LOG memory region holds as many entries as before
+ *          the requests count was added.
  */
 struct Monitor_InterfaceActivationEntry {
-	enum interfaces_enum interface;
-	enum Monitor_EntryType entry_type;
+	uint16_t interface;
+	uint16_t entry_type;
+	uint32_t requests_count;
 	uint64_t timestamp;
 };
 
+/**
+ * @brief   Layout of the header of a compact activation log record. Bits 0-7
+ *          hold the entry type. For an event record, bits 8-15 hold the
+ *          interface and bits 16-31 hold the requests count, saturated at
+ *          its maximum. For a sync record, bits 8-31 hold bits 32-55 of the
+ *          timestamps of the following records.
+ */
+#define MONITOR_COMPACT_ENTRY_TYPE_MASK 0xFFu
+#define MONITOR_COMPACT_ENTRY_INTERFACE_SHIFT 8u
+#define MONITOR_COMPACT_ENTRY_INTERFACE_MASK 0xFFu
+#define MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_SHIFT 16u
+#define MONITOR_COMPACT_ENTRY_REQUESTS_COUNT_MASK 0xFFFFu
+#define MONITOR_COMPACT_ENTRY_SYNC_TICKS_SHIFT 8u
+#define MONITOR_COMPACT_ENTRY_TYPE_SYNC 0xFFu
+
+/**
+ * @brief   Struct representing a record of the compact activation log, used
+ *          when RT_EXEC_LOG_COMPACT is defined. An event record holds
+ *          bits 0-31 of its timestamp, in raw ticks of Hal_GetElapsedTicks.
+ *          A sync record is stored only before the first event record whose
+ *          upper bits differ from the previous one, and holds the upper bits
+ *          of the timestamps of both the preceding and the following
+ *          records, in its ticks and in its header. The upper bits of the
+ *          latest record are also kept outside of the log, so records older
+ *          than the oldest stored sync record are decoded as well.
+ */
+struct Monitor_CompactActivationEntry {
+	uint32_t header;
+	uint32_t ticks;
+};
+
 /**
  * @brief                                       Typedef of callback indicating interface message queue overflow
  * 
@@ -85,6 +206,30 @@ typedef void (*Monitor_MessageQueueOverflow)(
 
 extern Monitor_MessageQueueOverflow Monitor_MessageQueueOverflowCallback;
 
+/**
+ * @brief                       Typedef of callback indicating deadline miss of cyclic interface
+ *
+ * @param[in] interface         represents interface which missed the deadline
+ * @param[in] response_time     represents time from the planned release to the end of activation
+ *
+ */
+typedef void (*Monitor_DeadlineMiss)(const enum interfaces_enum interface,
+				     const uint64_t response_time);
+
+extern Monitor_DeadlineMiss Monitor_DeadlineMissCallback;
+
+/**
+ * @brief                       Typedef of callback indicating execution budget overrun of an interface
+ *
+ * @param[in] interface         represents interface which exceeded its budget
+ * @param[in] budget            represents the exceeded execution budget
+ *
+ */
+typedef void (*Monitor_BudgetOverrun)(const enum interfaces_enum interface,
+				      const uint64_t budget);
+
+extern Monitor_BudgetOverrun Monitor_BudgetOverrunCallback;
+
 /**
  * @brief                       Initializes the Monitor module.
  *
@@ -95,7 +240,8 @@ bool Monitor_Init(void);
 
 /**
  * @brief                       Gathers monitoring information about every sporadic/cyclic interface and update 
- *                              internal data structure that hold these information.
+ *                              internal data structure that hold these information. In the deferred overflow
+ *                              reporting mode, also reports requests dropped since the previous tick.
  * 
  * @return                      Bool indicating whether the tick was successful
  */
@@ -103,7 +249,12 @@ bool Monitor_MonitoringTick(void);
 
 /**
  * @brief                       Returns structure containing information about maximum execution time, minimum execution time,
- *                              average execution time of a given sporadic/cyclic interface
+ *                              average execution time and execution time variance of a given sporadic/cyclic interface.
+ *                              The average and the variance are derived from integer statistics on every call,
+ *                              the average is also written back to mean_thread_execution_time of threads_info.
+ *                              Execution time is the wall time of an activation, CPU time is the part of it
+ *                              consumed by the interface thread, and interference time is the difference, spent
+ *                              in preempting threads and interrupt handlers.
  *
  * @param[in] interface         Represents interface to obtain usage data
  * @param[out] usage_data       pointer to struct representing usage data of given sporadic/cyclic
@@ -114,6 +265,171 @@ bool Monitor_MonitoringTick(void);
 bool Monitor_GetUsageData(const enum interfaces_enum interface,
 			  struct Monitor_InterfaceUsageData *const usage_data);
 
+/**
+ * @brief                       Informs the monitor about execution time of an activation of given interface.
+ *                              The times are accumulated in integer statistics, so the call does not use
+ *                              the FPU. The mean and the variance are derived in Monitor_GetUsageData.
+ *
+ * @param[in] interface         enum representing executed interface
+ * @param[in] execution_time    wall time of the activation in nanoseconds
+ * @param[in] cpu_time          CPU time used by the interface thread during the activation in nanoseconds
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateInterfaceExecutionTime(
+	const enum interfaces_enum interface, const uint64_t execution_time,
+	const uint64_t cpu_time);
+
+/**
+ * @brief                       Returns structure containing information about release jitter, start latency,
+ *                              response time and deadline misses of a given cyclic interface
+ *
+ * @param[in] interface         Represents interface to obtain timing data
+ * @param[out] timing_data      pointer to struct representing timing data of given cyclic interface
+ *
+ * @return                      Bool indicating whether the query about timing data was successful
+ */
+bool Monitor_GetInterfaceTimingData(
+	const enum interfaces_enum interface,
+	struct Monitor_InterfaceTimingData *const timing_data);
+
+/**
+ * @brief                       Informs the monitor that given cyclic interface is released by an RTEMS
+ *                              rate monotonic period instead of the cyclic dispatcher.
+ *
+ * @param[in] interface         enum representing released interface
+ * @param[in] period_id         id of the period
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicatePeriodCreated(const enum interfaces_enum interface,
+				   const rtems_id period_id);
+
+/**
+ * @brief                       Returns statistics of the RTEMS rate monotonic period releasing a given
+ *                              cyclic interface. Periods are counted by RTEMS, and a period is missed if
+ *                              the interface did not wait for the next release before the period ended.
+ *                              CPU and wall times are measured from the start of the period to the next
+ *                              wait.
+ *
+ * @param[in] interface         Represents interface to obtain period statistics
+ * @param[out] statistics       pointer to struct representing period statistics of given interface
+ *
+ * @return                      Bool indicating whether the query was successful, false if the interface
+ *                              is not released by a period
+ */
+bool Monitor_GetPeriodStatistics(
+	const enum interfaces_enum interface,
+	struct Monitor_PeriodStatistics *const statistics);
+
+/**
+ * @brief                       Sets relative deadline of a given cyclic interface. By default the deadline
+ *                              is equal to the period of the interface.
+ *
+ * @param[in] interface         Represents interface to set the deadline
+ * @param[in] deadline_ns       deadline measured from the planned release time, 0 restores the default
+ *
+ * @return                      Bool indicating whether the set was successful
+ */
+bool Monitor_SetInterfaceDeadline(const enum interfaces_enum interface,
+				  const uint64_t deadline_ns);
+
+/**
+ * @brief                        Set deadline miss callback, called from the context of the interface
+ *                               thread after the activation which missed the deadline.
+ *
+ * @param[in] deadline_miss_callback  pointer to function that implements deadline miss callback
+ *
+ * @return                       indicates whether the set was successful.
+ */
+bool Monitor_SetDeadlineMissCallback(
+	Monitor_DeadlineMiss deadline_miss_callback);
+
+/**
+ * @brief                        Set execution budget overrun callback, called from the interrupt context
+ *                               when the budget expires, while the overrunning activation is still in
+ *                               progress.
+ *
+ * @param[in] budget_overrun_callback  pointer to function that implements budget overrun callback
+ *
+ * @return                       indicates whether the set was successful.
+ */
+bool Monitor_SetBudgetOverrunCallback(
+	Monitor_BudgetOverrun budget_overrun_callback);
+
+/**
+ * @brief                       Informs the monitor that an activation of given interface exceeded
+ *                              its execution budget. Increments the overrun counter, stores an overrun
+ *                              entry in the activation log and calls the budget overrun callback.
+ *                              Can be called from the interrupt context.
+ *
+ * @param[in] interface         enum representing overrunning interface
+ * @param[in] budget            the exceeded execution budget in nanoseconds
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateBudgetOverrun(const enum interfaces_enum interface,
+				   const uint64_t budget);
+
+/**
+ * @brief                        Returns number of activations of given interface which exceeded
+ *                               the execution budget
+ *
+ * @param[in] interface          represents interface to obtain information about
+ *
+ * @return                       represents the number of budget overruns if >= 0, and error otherwise.
+ */
+int32_t Monitor_GetBudgetOverrunsCount(const enum interfaces_enum interface);
+
+/**
+ * @brief                       Informs the monitor about timing of an activation of a cyclic interface.
+ *
+ * @param[in] interface         enum representing activated interface
+ * @param[in] planned_release   planned release time
+ * @param[in] actual_release    time when the release was sent to the interface
+ * @param[in] start             time when the execution of the interface started
+ * @param[in] finish            time when the execution of the interface finished
+ * @param[in] period            period of the interface, used as the default deadline
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateCyclicActivationTiming(
+	const enum interfaces_enum interface, const uint64_t planned_release,
+	const uint64_t actual_release, const uint64_t start,
+	const uint64_t finish, const uint64_t period);
+
+/**
+ * @brief                       Informs the monitor that releases of a cyclic interface were coalesced
+ *                              into a single activation, because the interface was not ready when they
+ *                              happened.
+ *
+ * @param[in] interface         enum representing released interface
+ * @param[in] releases_count    number of releases without own activation
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateReleasesCoalesced(const enum interfaces_enum interface,
+				       const uint32_t releases_count);
+
+/**
+ * @brief                       Returns structure containing information about acquisitions, wait time and
+ *                              hold time of a given Hal semaphore. Times are expressed in nanoseconds,
+ *                              average wait time is calculated over contended acquisitions.
+ *
+ * @param[in] semaphore_id      id of the semaphore returned by Hal_SemaphoreCreate
+ * @param[out] usage_data       pointer to struct representing usage data of given semaphore
+ *
+ * @return                      Bool indicating whether the query about usage data was successful
+ */
+bool Monitor_GetSemaphoreUsageData(
+	const int32_t semaphore_id,
+	struct Monitor_SemaphoreUsageData *const usage_data);
+
 /**
  * @brief                       Returns structure containing information about current CPU usage in idle state (time when CPU was not
  *                              used by any sporadic/cyclic interface)
@@ -146,7 +462,50 @@ bool Monitor_SetMessageQueueOverflowCallback(
 	Monitor_MessageQueueOverflow overflow_callback);
 
 /**
- * @brief                        Checks and returns current number of queued items in sporadic interface queue
+ * @brief                        Sets when the message queue overflow callback is called. In the immediate
+ *                               mode, which is the default, the callback is called by the sender on every
+ *                               overflow. In the deferred mode, drops are accumulated and the callback is
+ *                               called by Monitor_MonitoringTick, once per interface with the number of
+ *                               requests dropped since the previous report, so the overloaded sender does
+ *                               not execute the callback.
+ *
+ * @param[in] mode               overflow reporting mode
+ *
+ * @return                       indicates whether the set was successful.
+ */
+bool Monitor_SetOverflowReportingMode(
+	const enum Monitor_OverflowReportingMode mode);
+
+/**
+ * @brief                       Informs the monitor that requests sent to given interface were dropped
+ *                              because its queue was full. Updates the drop counters and, in the
+ *                              immediate reporting mode, calls the overflow callback.
+ *
+ * @param[in] interface         enum representing receiving interface
+ * @param[in] requests_count    number of dropped requests
+ *
+ * @return                      Bool indicating whether the overflow is reported, i.e. whether the
+ *                              overflow callback is set
+ */
+bool Monitor_IndicateRequestsDropped(const enum interfaces_enum interface,
+				     const uint32_t requests_count);
+
+/**
+ * @brief                       Returns counters of requests dropped because the queue of given
+ *                              interface was full.
+ *
+ * @param[in] interface         represents interface to obtain information about
+ * @param[out] overflow_data    structure containing drop counters and times
+ *
+ * @return                      Bool indicating whether the query was successful
+ */
+bool Monitor_GetOverflowData(const enum interfaces_enum interface,
+			     struct Monitor_OverflowData *const overflow_data);
+
+/**
+ * @brief                        Checks and returns current number of queued items in sporadic interface queue.
+ *                               Items are counted by the runtime when they are sent and processed, so
+ *                               the check does not call the RTOS.
  *
  * @param[in] interface          represents interface to obtain information about stack usage
  * 
@@ -164,6 +523,92 @@ int32_t Monitor_GetQueuedItemsCount(const enum interfaces_enum interface);
 int32_t
 Monitor_GetMaximumQueuedItemsCount(const enum interfaces_enum interface);
 
+/**
+ * @brief                       Informs the monitor that given interface receives requests through
+ *                              a queue implemented by the runtime instead of an RTOS message queue.
+ *
+ * @param[in] interface         enum representing receiving interface
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateInterfaceQueueCreated(
+	const enum interfaces_enum interface);
+
+/**
+ * @brief                       Informs the monitor that a request was placed in the queue of given
+ *                              interface. Updates the number of queued items and its maximum.
+ *
+ * @param[in] interface         enum representing receiving interface
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateRequestQueued(const enum interfaces_enum interface);
+
+/**
+ * @brief                       Informs the monitor that a request was taken from the queue of given
+ *                              interface.
+ *
+ * @param[in] interface         enum representing receiving interface
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateRequestDequeued(const enum interfaces_enum interface);
+
+/**
+ * @brief                       Informs the monitor that a request was placed in the given priority lane
+ *                              of the interface. The lane is accounted in addition to the whole queue,
+ *                              which is updated with Monitor_IndicateRequestQueued.
+ *
+ * @param[in] interface         enum representing receiving interface
+ * @param[in] lane              index of the lane, less than RT_MAX_REQUEST_LANES
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateLaneRequestQueued(const enum interfaces_enum interface,
+				       const uint32_t lane);
+
+/**
+ * @brief                       Informs the monitor that a request was taken from the given priority lane
+ *                              of the interface.
+ *
+ * @param[in] interface         enum representing receiving interface
+ * @param[in] lane              index of the lane, less than RT_MAX_REQUEST_LANES
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateLaneRequestDequeued(const enum interfaces_enum interface,
+					 const uint32_t lane);
+
+/**
+ * @brief                        Returns current number of queued items in the given priority lane of
+ *                               sporadic interface.
+ *
+ * @param[in] interface          represents interface to obtain information about
+ * @param[in] lane               index of the lane, less than RT_MAX_REQUEST_LANES
+ *
+ * @return                       represents the number of queued items in the lane if >= 0, and error otherwise.
+ */
+int32_t Monitor_GetLaneQueuedItemsCount(const enum interfaces_enum interface,
+					const uint32_t lane);
+
+/**
+ * @brief                        Returns maximum reached number of queued items in the given priority lane
+ *                               of sporadic interface.
+ *
+ * @param[in] interface          represents interface to obtain information about
+ * @param[in] lane               index of the lane, less than RT_MAX_REQUEST_LANES
+ *
+ * @return                       represents the maximum number of queued items in the lane if >= 0, and error otherwise.
+ */
+int32_t
+Monitor_GetMaximumLaneQueuedItemsCount(const enum interfaces_enum interface,
+				       const uint32_t lane);
+
 /**
  * @brief                       Informs the monitor about given interface activation, 
  *                              monitor stores timestamp of activation in specific 
@@ -188,8 +633,25 @@ bool Monitor_IndicateInterfaceActivated(const enum interfaces_enum interface);
  */
 bool Monitor_IndicateInterfaceDeactivated(const enum interfaces_enum interface);
 
+/**
+ * @brief                       Informs the monitor about given interface deactivation after processing
+ *                              a batch of requests, monitor stores timestamp of deactivation and number
+ *                              of processed requests in specific configurable memory location.
+ *
+ * @param[in] interface         enum representing deactivated interface
+ * @param[in] requests_count    number of requests processed in the activation
+ *
+ * @return                      Bool indicating whether the indication was
+ *                              successful
+ */
+bool Monitor_IndicateInterfaceBatchDeactivated(
+	const enum interfaces_enum interface, const uint32_t requests_count);
+
 /**
  * @brief                                            Provides access to optional interface activation log.
+ *                                                   Not available when RT_EXEC_LOG_COMPACT is defined,
+ *                                                   see Monitor_GetCompactActivationLog and
+ *                                                   Monitor_DecodeInterfaceActivationLog.
  *
  * @param[out] activation_log                        pointer pointing to beginning of cyclic buffer holding 
  *                                                   all activation entries
@@ -203,6 +665,37 @@ bool Monitor_GetInterfaceActivationEntryLog(
 	uint32_t *out_latest_activation_entry_index,
 	uint32_t *out_size_of_activation_log);
 
+/**
+ * @brief                                            Provides access to optional compact interface activation log,
+ *                                                   for decoding on the host.
+ *
+ * @param[out] activation_log                        pointer pointing to beginning of cyclic buffer holding
+ *                                                   all compact records
+ * @param[out] out_latest_activation_entry_index     representing latest record index
+ * @param[out] out_size_of_activation_log            representing number of stored records
+ *
+ * @return                                           Bool indicating whether the query was successful, false
+ *                                                   if RT_EXEC_LOG_COMPACT is not defined
+ */
+bool Monitor_GetCompactActivationLog(
+	const struct Monitor_CompactActivationEntry **activation_log,
+	uint32_t *out_latest_activation_entry_index,
+	uint32_t *out_size_of_activation_log);
+
+/**
+ * @brief                       Decodes the compact interface activation log, from the oldest record to
+ *                              the latest one, converting timestamps to nanoseconds. Sync records are not
+ *                              returned. Intended to be called while logging is frozen.
+ *
+ * @param[out] entries          array receiving decoded entries
+ * @param[in] max_entries_count size of the entries array
+ *
+ * @return                      Number of decoded entries, 0 if RT_EXEC_LOG_COMPACT is not defined
+ */
+uint32_t Monitor_DecodeInterfaceActivationLog(
+	struct Monitor_InterfaceActivationEntry *const entries,
+	const uint32_t max_entries_count);
+
 /**
  * @brief                       Stops storing of interface activation logs, all activation 
  *                              logs are lost after this operation
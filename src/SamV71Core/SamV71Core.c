@@ -35,6 +35,7 @@
 Pmc pmc;
 static Mpu mpu;
 static uint64_t mck_frequency = 0;
+static uint64_t processor_clock_frequency = 0;
 
 static void extract_main_oscilator_frequency(void)
 {
@@ -134,6 +135,9 @@ static void extract_mck_frequency(void)
 #endif
 	}
 
+	// The processor clock is taken before the master clock divider
+	processor_clock_frequency = mck_frequency;
+
 	switch (master_clock_config.divider) {
 	case Pmc_MasterckDiv_1: {
 		break;
@@ -238,6 +242,11 @@ uint64_t SamV71Core_GetMainClockFrequency(void)
 	return mck_frequency;
 }
 
+uint64_t SamV71Core_GetProcessorClockFrequency(void)
+{
+	return processor_clock_frequency;
+}
+
 void SamV71Core_InterruptSubscribe(const rtems_vector_number vector,
 				   const char *info,
 				   rtems_interrupt_handler handler,
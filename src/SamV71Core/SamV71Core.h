@@ -65,6 +65,13 @@ void SamV71Core_EnablePeripheralClock(const Pmc_PeripheralId peripheralId);
  */
 uint64_t SamV71Core_GetMainClockFrequency(void);
 
+/**
+ * @brief               Get frequency of processor clock (HCLK).
+ *
+ * @return              Processor clock frequency in Hz.
+ */
+uint64_t SamV71Core_GetProcessorClockFrequency(void);
+
 /**
  * @brief               Generate new unique name for semaphore.
  *
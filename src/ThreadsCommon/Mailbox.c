@@ -0,0 +1,93 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Mailbox.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Slot layout: message size, padding, message data
+#define SLOT_DATA_OFFSET (2u * sizeof(uint32_t))
+// Set in the middle index when the slot holds a value not read yet
+#define NEW_VALUE_FLAG 0x80000000u
+
+static inline uint8_t *get_slot(const struct Mailbox *const mailbox,
+				const uint32_t index)
+{
+	return mailbox->storage + index * mailbox->slot_size;
+}
+
+bool Mailbox_Init(struct Mailbox *const mailbox, void *const storage,
+		  const uint32_t message_size)
+{
+	if (storage == NULL || (uintptr_t)storage % MAILBOX_ALIGNMENT != 0u) {
+		return false;
+	}
+
+	mailbox->storage = (uint8_t *)storage;
+	mailbox->message_size = message_size;
+	mailbox->slot_size = MAILBOX_SLOT_SIZE(message_size);
+	mailbox->front = 0u;
+	mailbox->middle = 1u;
+	mailbox->back = 2u;
+
+	return true;
+}
+
+bool Mailbox_Write(struct Mailbox *const mailbox, const void *const data,
+		   const uint32_t size, bool *const is_first)
+{
+	if (size > mailbox->message_size) {
+		return false;
+	}
+
+	uint8_t *const slot = get_slot(mailbox, mailbox->back);
+	memcpy(slot, &size, sizeof(size));
+	memcpy(slot + SLOT_DATA_OFFSET, data, size);
+
+	const uint32_t previous =
+		__atomic_exchange_n(&mailbox->middle,
+				    mailbox->back | NEW_VALUE_FLAG,
+				    __ATOMIC_ACQ_REL);
+	mailbox->back = previous & ~NEW_VALUE_FLAG;
+
+	*is_first = (previous & NEW_VALUE_FLAG) == 0u;
+
+	return true;
+}
+
+bool Mailbox_Read(struct Mailbox *const mailbox, const void **const data,
+		  uint32_t *const size)
+{
+	if ((__atomic_load_n(&mailbox->middle, __ATOMIC_ACQUIRE) &
+	     NEW_VALUE_FLAG) == 0u) {
+		return false;
+	}
+
+	// Only the consumer clears the flag, so the exchanged slot holds
+	// the new value
+	const uint32_t previous = __atomic_exchange_n(
+		&mailbox->middle, mailbox->front, __ATOMIC_ACQ_REL);
+	mailbox->front = previous & ~NEW_VALUE_FLAG;
+
+	const uint8_t *const slot = get_slot(mailbox, mailbox->front);
+	memcpy(size, slot, sizeof(*size));
+	*data = slot + SLOT_DATA_OFFSET;
+	return true;
+}
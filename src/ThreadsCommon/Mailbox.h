@@ -0,0 +1,113 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+/**
+ * @file    Mailbox.h
+ * @brief   Triple buffer holding the latest value written by a single
+ *          producer.
+ *
+ * The producer never blocks and never fails, a value not yet read is
+ * overwritten by a newer one. The consumer gets every value at most once,
+ * and accesses it in place until the next read. Both sides are wait-free
+ * and do not disable interrupts. The storage is provided by the user.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MAILBOX_SLOTS_COUNT 3u
+#define MAILBOX_ALIGNMENT 8u
+
+/**
+ * @brief   Size of a slot holding messages of the given maximum size
+ */
+#define MAILBOX_SLOT_SIZE(message_size)                  \
+	(sizeof(uint32_t) + sizeof(uint32_t) +           \
+	 (((message_size) + MAILBOX_ALIGNMENT - 1u) &    \
+	  ~(MAILBOX_ALIGNMENT - 1u)))
+
+/**
+ * @brief   Size of the storage required by a mailbox holding messages of the
+ *          given maximum size
+ */
+#define MAILBOX_STORAGE_SIZE(message_size) \
+	(MAILBOX_SLOTS_COUNT * MAILBOX_SLOT_SIZE(message_size))
+
+/**
+ * @brief   Struct representing the mailbox. Each of the three slots is owned
+ *          either by the producer, by the consumer, or is exchanged between
+ *          them through the middle index.
+ */
+struct Mailbox {
+	uint8_t *storage;
+	uint32_t message_size;
+	uint32_t slot_size;
+	uint32_t middle;
+	uint32_t back;
+	uint32_t front;
+};
+
+/**
+ * @brief                   Initializes an empty mailbox
+ *
+ * @param[out] mailbox      mailbox to initialize
+ * @param[in] storage       storage of MAILBOX_STORAGE_SIZE bytes, aligned to
+ *                          MAILBOX_ALIGNMENT
+ * @param[in] message_size  maximum size of a message
+ *
+ * @return                  Bool indicating whether the initialization was
+ *                          successful
+ */
+bool Mailbox_Init(struct Mailbox *const mailbox, void *const storage,
+		  const uint32_t message_size);
+
+/**
+ * @brief                   Publishes a new value. Called only by the
+ *                          producer.
+ *
+ * @param[in,out] mailbox   mailbox
+ * @param[in] data          message data
+ * @param[in] size          message size
+ * @param[out] is_first     set if the previous value was already read, i.e.
+ *                          the consumer may need a wakeup
+ *
+ * @return                  Bool indicating whether the value was published,
+ *                          false only if the message is too big
+ */
+bool Mailbox_Write(struct Mailbox *const mailbox, const void *const data,
+		   const uint32_t size, bool *const is_first);
+
+/**
+ * @brief                   Takes the latest value, if it was not read yet.
+ *                          Called only by the consumer. The value stays
+ *                          valid until the next call.
+ *
+ * @param[in,out] mailbox   mailbox
+ * @param[out] data         message data
+ * @param[out] size         message size
+ *
+ * @return                  Bool indicating whether there was a new value
+ */
+bool Mailbox_Read(struct Mailbox *const mailbox, const void **const data,
+		  uint32_t *const size);
+
+#endif
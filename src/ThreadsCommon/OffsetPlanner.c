@@ -0,0 +1,226 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OffsetPlanner.h"
+
+#include <stddef.h>
+
+// Marks interfaces not placed yet during planning
+#define UNPLANNED_OFFSET UINT64_MAX
+
+struct PlacementCost {
+	uint32_t overlaps_count;
+	uint64_t overlap_time;
+	uint64_t separation;
+};
+
+static uint64_t gcd(uint64_t a, uint64_t b)
+{
+	while (b != 0u) {
+		const uint64_t remainder = a % b;
+		a = b;
+		b = remainder;
+	}
+	return a;
+}
+
+static inline uint64_t min_u64(const uint64_t a, const uint64_t b)
+{
+	return a < b ? a : b;
+}
+
+// Overlap of activations of the first interface released at the given
+// offset and of the second interface, within one gcd of their periods
+static uint64_t
+get_overlap_time(const struct OffsetPlanner_Interface *const first,
+		 const uint64_t first_offset,
+		 const struct OffsetPlanner_Interface *const second,
+		 uint64_t *const separation)
+{
+	const uint64_t period_gcd = gcd(first->period_ns, second->period_ns);
+	// Distance from a release of the second interface to the next
+	// release of the first one, and back
+	const uint64_t after_second =
+		(first_offset % period_gcd + period_gcd -
+		 second->offset_ns % period_gcd) %
+		period_gcd;
+	const uint64_t after_first =
+		(period_gcd - after_second) % period_gcd;
+
+	*separation = min_u64(after_second, after_first);
+
+	uint64_t overlap_time = 0u;
+	if (after_second < second->wcet_ns) {
+		overlap_time += min_u64(second->wcet_ns - after_second,
+					first->wcet_ns);
+	}
+	if (after_second != 0u && after_first < first->wcet_ns) {
+		overlap_time += min_u64(first->wcet_ns - after_first,
+					second->wcet_ns);
+	}
+	return overlap_time;
+}
+
+static struct PlacementCost
+get_placement_cost(const struct OffsetPlanner_Interface *const interfaces,
+		   const uint32_t count, const uint32_t placed_index,
+		   const uint64_t offset)
+{
+	struct PlacementCost cost = {
+		.overlaps_count = 0u,
+		.overlap_time = 0u,
+		.separation = UINT64_MAX,
+	};
+
+	for (uint32_t i = 0u; i < count; i++) {
+		if (i == placed_index ||
+		    interfaces[i].offset_ns == UNPLANNED_OFFSET) {
+			continue;
+		}
+
+		uint64_t separation;
+		const uint64_t overlap_time =
+			get_overlap_time(&interfaces[placed_index], offset,
+					 &interfaces[i], &separation);
+		// Simultaneous releases count as an overlap even without
+		// known execution times
+		if (overlap_time > 0u || separation == 0u) {
+			cost.overlaps_count++;
+		}
+		cost.overlap_time += overlap_time;
+		cost.separation = min_u64(cost.separation, separation);
+	}
+
+	return cost;
+}
+
+static bool is_cheaper(const struct PlacementCost *const cost,
+		       const struct PlacementCost *const best)
+{
+	if (cost->overlaps_count != best->overlaps_count) {
+		return cost->overlaps_count < best->overlaps_count;
+	}
+	if (cost->overlap_time != best->overlap_time) {
+		return cost->overlap_time < best->overlap_time;
+	}
+	return cost->separation > best->separation;
+}
+
+static uint32_t
+find_next_to_place(const struct OffsetPlanner_Interface *const interfaces,
+		   const uint32_t count)
+{
+	// Shortest period first, the longest WCET first among equal periods
+	uint32_t next = count;
+	for (uint32_t i = 0u; i < count; i++) {
+		if (interfaces[i].offset_ns != UNPLANNED_OFFSET) {
+			continue;
+		}
+		if (next == count ||
+		    interfaces[i].period_ns < interfaces[next].period_ns ||
+		    (interfaces[i].period_ns == interfaces[next].period_ns &&
+		     interfaces[i].wcet_ns > interfaces[next].wcet_ns)) {
+			next = i;
+		}
+	}
+	return next;
+}
+
+static uint64_t
+get_candidates_range(const struct OffsetPlanner_Interface *const interfaces,
+		     const uint32_t count, const uint32_t placed_index)
+{
+	// Costs repeat with the least common multiple of gcds of the period
+	// with periods of already placed interfaces, which divides the period
+	const uint64_t period = interfaces[placed_index].period_ns;
+	uint64_t range = 1u;
+	for (uint32_t i = 0u; i < count && range < period; i++) {
+		if (i == placed_index ||
+		    interfaces[i].offset_ns == UNPLANNED_OFFSET) {
+			continue;
+		}
+		const uint64_t period_gcd = gcd(period, interfaces[i].period_ns);
+		range = range / gcd(range, period_gcd) * period_gcd;
+	}
+	return range;
+}
+
+bool OffsetPlanner_Plan(struct OffsetPlanner_Interface *const interfaces,
+			const uint32_t count, const uint64_t granularity_ns)
+{
+	if (interfaces == NULL || granularity_ns == 0u) {
+		return false;
+	}
+
+	for (uint32_t i = 0u; i < count; i++) {
+		if (interfaces[i].period_ns == 0u) {
+			return false;
+		}
+		interfaces[i].offset_ns = UNPLANNED_OFFSET;
+	}
+
+	for (uint32_t placed = 0u; placed < count; placed++) {
+		const uint32_t index = find_next_to_place(interfaces, count);
+		const uint64_t range =
+			get_candidates_range(interfaces, count, index);
+
+		// The step stays a multiple of the granularity
+		uint64_t step = granularity_ns;
+		if (range / step > RT_OFFSET_PLANNER_MAX_CANDIDATES) {
+			step *= (range / step + RT_OFFSET_PLANNER_MAX_CANDIDATES -
+				 1u) /
+				RT_OFFSET_PLANNER_MAX_CANDIDATES;
+		}
+
+		uint64_t best_offset = 0u;
+		struct PlacementCost best_cost =
+			get_placement_cost(interfaces, count, index, 0u);
+		for (uint64_t offset = step; offset < range; offset += step) {
+			const struct PlacementCost cost = get_placement_cost(
+				interfaces, count, index, offset);
+			if (is_cheaper(&cost, &best_cost)) {
+				best_cost = cost;
+				best_offset = offset;
+			}
+		}
+
+		interfaces[index].offset_ns = best_offset;
+	}
+
+	return true;
+}
+
+uint32_t OffsetPlanner_CountOverlaps(
+	const struct OffsetPlanner_Interface *const interfaces,
+	const uint32_t count)
+{
+	uint32_t overlaps_count = 0u;
+	for (uint32_t i = 0u; i < count; i++) {
+		for (uint32_t j = i + 1u; j < count; j++) {
+			uint64_t separation;
+			if (get_overlap_time(&interfaces[i],
+					     interfaces[i].offset_ns,
+					     &interfaces[j], &separation) > 0u ||
+			    separation == 0u) {
+				overlaps_count++;
+			}
+		}
+	}
+	return overlaps_count;
+}
@@ -0,0 +1,96 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OFFSETPLANNER_H
+#define OFFSETPLANNER_H
+
+/**
+ * @file    OffsetPlanner.h
+ * @brief   Planner of release offsets of cyclic interfaces, spreading the
+ *          releases so that as few activations as possible are ready at the
+ *          same time.
+ *
+ * The planner is independent of the RTOS, so it can be used during system
+ * initialization as well as in host tools generating the offsets. It does
+ * not allocate memory and works on the array provided by the caller.
+ *
+ * Releases of two interfaces with periods P1 and P2 are always separated by
+ * a multiple of gcd(P1, P2) shifted by the difference of their offsets, so
+ * whether their activations can overlap depends only on the offsets modulo
+ * the gcd. Interfaces are placed one by one, from the shortest period, each
+ * at the offset minimizing the number of overlapping pairs, then the total
+ * overlap time, and then maximizing the distance to the nearest release of
+ * an already placed interface.
+ *
+ * The cost is pairwise only. Three activations ready at the same time cost
+ * as much as three overlaps of separate pairs, so the peak number of ready
+ * activations, and so the peak length of the ready queue, is not minimized
+ * directly. Sets which cannot be separated may be planned with a higher
+ * peak than the best possible one.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef RT_OFFSET_PLANNER_MAX_CANDIDATES
+#define RT_OFFSET_PLANNER_MAX_CANDIDATES 1024u
+#endif
+
+/**
+ * @brief   Struct representing a cyclic interface to plan
+ */
+struct OffsetPlanner_Interface {
+	uint64_t period_ns; ///< Input, greater than 0
+	uint64_t wcet_ns; ///< Input, measured or declared, can be 0
+	uint64_t offset_ns; ///< Output, less than the period
+};
+
+/**
+ * @brief                   Computes offsets of the given interfaces. At most
+ *                          RT_OFFSET_PLANNER_MAX_CANDIDATES offsets are
+ *                          evaluated per interface, the step is increased
+ *                          above the granularity if needed.
+ *
+ * @param[in,out] interfaces    interfaces to plan, offsets are overwritten
+ * @param[in] count         number of interfaces
+ * @param[in] granularity_ns    step between evaluated offsets, greater
+ *                              than 0
+ *
+ * @return                  Bool indicating whether the planning was
+ *                          successful
+ */
+bool OffsetPlanner_Plan(struct OffsetPlanner_Interface *const interfaces,
+			const uint32_t count, const uint64_t granularity_ns);
+
+/**
+ * @brief                   Counts pairs of interfaces whose activations can
+ *                          overlap with the current offsets, assuming every
+ *                          activation starts at its release and lasts for
+ *                          the WCET. Intended to evaluate a plan.
+ *
+ * @param[in] interfaces    interfaces with offsets
+ * @param[in] count         number of interfaces
+ *
+ * @return                  Number of overlapping pairs
+ */
+uint32_t OffsetPlanner_CountOverlaps(
+	const struct OffsetPlanner_Interface *const interfaces,
+	const uint32_t count);
+
+#endif
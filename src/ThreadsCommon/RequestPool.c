@@ -0,0 +1,214 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RequestPool.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <rtems.h>
+
+static inline struct RequestPool_BlockHeader *
+get_block_header(const void *const buffer)
+{
+	return (struct RequestPool_BlockHeader *)buffer - 1;
+}
+
+bool RequestPool_Init(struct RequestPool *const pool, void *const storage,
+		      const uint32_t block_size, const uint32_t blocks_count)
+{
+	if (storage == NULL || block_size == 0u || blocks_count == 0u ||
+	    (uintptr_t)storage % REQUEST_POOL_ALIGNMENT != 0u) {
+		return false;
+	}
+
+	pool->storage = (uint8_t *)storage;
+	pool->block_size = block_size;
+	pool->stride = REQUEST_POOL_STORAGE_SIZE(block_size, 1u);
+	pool->blocks_count = blocks_count;
+	pool->free_blocks_count = blocks_count;
+	pool->free_list = NULL;
+
+	for (uint32_t i = blocks_count; i > 0u; i--) {
+		struct RequestPool_BlockHeader *const header =
+			(struct RequestPool_BlockHeader *)(pool->storage +
+							   (i - 1u) *
+								   pool->stride);
+		header->state = RequestPool_BlockState_Free;
+		header->next = pool->free_list;
+		pool->free_list = header;
+	}
+
+	return true;
+}
+
+void *RequestPool_Allocate(struct RequestPool *const pool)
+{
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	struct RequestPool_BlockHeader *const header = pool->free_list;
+	if (header != NULL) {
+		assert(header->state == RequestPool_BlockState_Free);
+		pool->free_list = header->next;
+		pool->free_blocks_count--;
+		header->next = NULL;
+		header->state = RequestPool_BlockState_Allocated;
+	}
+	rtems_interrupt_local_enable(level);
+
+	return header != NULL ? (void *)(header + 1) : NULL;
+}
+
+void RequestPool_Free(struct RequestPool *const pool, void *const buffer)
+{
+	assert(RequestPool_Contains(pool, buffer));
+	struct RequestPool_BlockHeader *const header = get_block_header(buffer);
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	// Detects double release and release of a block never allocated
+	assert(header->state == RequestPool_BlockState_Allocated ||
+	       header->state == RequestPool_BlockState_Queued);
+	header->state = RequestPool_BlockState_Free;
+	header->next = pool->free_list;
+	pool->free_list = header;
+	pool->free_blocks_count++;
+	rtems_interrupt_local_enable(level);
+}
+
+void *RequestPool_Take(struct RequestPool *const pool,
+		       const void *const request_data,
+		       const uint32_t request_size)
+{
+	if (request_size > pool->block_size) {
+		RequestPool_Discard(pool, request_data);
+		return NULL;
+	}
+
+	if (RequestPool_Contains(pool, request_data)) {
+		return (void *)request_data;
+	}
+
+	void *const buffer = RequestPool_Allocate(pool);
+	if (buffer != NULL) {
+		memcpy(buffer, request_data, request_size);
+	}
+	return buffer;
+}
+
+void RequestPool_Discard(struct RequestPool *const pool,
+			 const void *const request_data)
+{
+	if (RequestPool_Contains(pool, request_data)) {
+		RequestPool_Free(pool, (void *)request_data);
+	}
+}
+
+uint32_t RequestPool_GetFreeBlocksCount(const struct RequestPool *const pool)
+{
+	return __atomic_load_n(&pool->free_blocks_count, __ATOMIC_RELAXED);
+}
+
+bool RequestPool_Contains(const struct RequestPool *const pool,
+			  const void *const buffer)
+{
+	const uintptr_t address = (uintptr_t)buffer;
+	const uintptr_t first_buffer = (uintptr_t)pool->storage +
+				       sizeof(struct RequestPool_BlockHeader);
+	const uintptr_t end =
+		(uintptr_t)pool->storage + pool->blocks_count * pool->stride;
+
+	return address >= first_buffer && address < end &&
+	       (address - first_buffer) % pool->stride == 0u;
+}
+
+void RequestPool_MarkQueued(const struct RequestPool *const pool,
+			    void *const buffer)
+{
+	assert(RequestPool_Contains(pool, buffer));
+	struct RequestPool_BlockHeader *const header = get_block_header(buffer);
+
+	// Only the sender which allocated the block can pass it on
+	assert(header->state == RequestPool_BlockState_Allocated);
+	header->state = RequestPool_BlockState_Queued;
+	(void)pool;
+}
+
+void RequestPool_AssertQueued(const struct RequestPool *const pool,
+			      const void *const buffer)
+{
+	assert(RequestPool_Contains(pool, buffer));
+	assert(get_block_header(buffer)->state ==
+	       RequestPool_BlockState_Queued);
+	(void)pool;
+	(void)buffer;
+}
+
+void RequestPool_QueueInit(struct RequestPool_Queue *const queue)
+{
+	queue->head = NULL;
+	queue->tail = NULL;
+}
+
+void RequestPool_Enqueue(const struct RequestPool *const pool,
+			 struct RequestPool_Queue *const queue,
+			 void *const buffer, const uint32_t size,
+			 bool *const is_first)
+{
+	RequestPool_MarkQueued(pool, buffer);
+	struct RequestPool_BlockHeader *const header = get_block_header(buffer);
+	header->size = size;
+	header->next = NULL;
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	*is_first = queue->head == NULL;
+	if (*is_first) {
+		queue->head = header;
+	} else {
+		queue->tail->next = header;
+	}
+	queue->tail = header;
+	rtems_interrupt_local_enable(level);
+}
+
+bool RequestPool_Dequeue(struct RequestPool_Queue *const queue,
+			 void **const buffer, uint32_t *const size)
+{
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	struct RequestPool_BlockHeader *const header = queue->head;
+	if (header != NULL) {
+		assert(header->state == RequestPool_BlockState_Queued);
+		queue->head = header->next;
+		if (queue->head == NULL) {
+			queue->tail = NULL;
+		}
+		header->next = NULL;
+	}
+	rtems_interrupt_local_enable(level);
+
+	if (header == NULL) {
+		return false;
+	}
+
+	*buffer = header + 1;
+	*size = header->size;
+	return true;
+}
@@ -0,0 +1,238 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REQUESTPOOL_H
+#define REQUESTPOOL_H
+
+/**
+ * @file    RequestPool.h
+ * @brief   Pool of fixed-size blocks holding requests passed between
+ *          interfaces without copying.
+ *
+ * The storage is provided by the user, so the pool does not allocate memory.
+ * Every block is preceded by a header tracking its owner, which is checked
+ * with assertions on every transition. Allocation and release are protected
+ * by disabling interrupts, so they can be used from any context.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REQUEST_POOL_ALIGNMENT 8u
+
+/**
+ * @brief   Size of the storage required by a pool of the given number of
+ *          blocks of the given size
+ */
+#define REQUEST_POOL_STORAGE_SIZE(block_size, blocks_count)            \
+	((blocks_count) *                                              \
+	 (sizeof(struct RequestPool_BlockHeader) +                     \
+	  (((block_size) + REQUEST_POOL_ALIGNMENT - 1u) &              \
+	   ~(REQUEST_POOL_ALIGNMENT - 1u))))
+
+/**
+ * @brief   Enum representing the owner of a block
+ */
+enum RequestPool_BlockState {
+	RequestPool_BlockState_Free = 0x46524545, ///< In the pool
+	RequestPool_BlockState_Allocated = 0x414C4C43, ///< Filled by sender
+	RequestPool_BlockState_Queued = 0x51554555, ///< Owned by receiver
+};
+
+/**
+ * @brief   Struct representing the header of a block
+ */
+struct RequestPool_BlockHeader {
+	struct RequestPool_BlockHeader *next;
+	enum RequestPool_BlockState state;
+	uint32_t size;
+} __attribute__((aligned(REQUEST_POOL_ALIGNMENT)));
+
+/**
+ * @brief   Struct representing a request passed through a queue in place of
+ *          the request data
+ */
+struct RequestPool_Handle {
+	void *buffer;
+	uint32_t size;
+};
+
+/**
+ * @brief   Struct representing a FIFO of queued blocks, linked through their
+ *          headers, so it needs no storage of its own
+ */
+struct RequestPool_Queue {
+	struct RequestPool_BlockHeader *head;
+	struct RequestPool_BlockHeader *tail;
+};
+
+/**
+ * @brief   Struct representing the pool
+ */
+struct RequestPool {
+	uint8_t *storage;
+	uint32_t block_size;
+	uint32_t stride;
+	uint32_t blocks_count;
+	uint32_t free_blocks_count;
+	struct RequestPool_BlockHeader *free_list;
+};
+
+/**
+ * @brief                   Initializes the pool, all blocks are free
+ *
+ * @param[out] pool         pool to initialize
+ * @param[in] storage       storage of REQUEST_POOL_STORAGE_SIZE bytes,
+ *                          aligned to REQUEST_POOL_ALIGNMENT
+ * @param[in] block_size    size of a single block in bytes
+ * @param[in] blocks_count  number of blocks
+ *
+ * @return                  Bool indicating whether the initialization was
+ *                          successful
+ */
+bool RequestPool_Init(struct RequestPool *const pool, void *const storage,
+		      const uint32_t block_size, const uint32_t blocks_count);
+
+/**
+ * @brief                   Takes a free block from the pool
+ *
+ * @param[in,out] pool      pool
+ *
+ * @return                  Buffer of block_size bytes or NULL if the pool
+ *                          is exhausted
+ */
+void *RequestPool_Allocate(struct RequestPool *const pool);
+
+/**
+ * @brief                   Returns a block to the pool
+ *
+ * @param[in,out] pool      pool
+ * @param[in] buffer        buffer returned by RequestPool_Allocate
+ */
+void RequestPool_Free(struct RequestPool *const pool, void *const buffer);
+
+/**
+ * @brief                   Takes the block passing a request to the
+ *                          receiver. A request filled in place in a block
+ *                          of the pool is passed on, any other request is
+ *                          copied once into a newly allocated block. A
+ *                          block filled in place is owned by the pool after
+ *                          the call, so it is freed if the request cannot
+ *                          be passed on.
+ *
+ * @param[in,out] pool      pool
+ * @param[in] request_data  request data, possibly a block of the pool
+ * @param[in] request_size  size of the request data
+ *
+ * @return                  Buffer holding the request or NULL if the
+ *                          request is bigger than a block or the pool is
+ *                          exhausted
+ */
+void *RequestPool_Take(struct RequestPool *const pool,
+		       const void *const request_data,
+		       const uint32_t request_size);
+
+/**
+ * @brief                   Returns the request to the pool if it was filled
+ *                          in place in a block of the pool, used when the
+ *                          request is rejected before it is taken
+ *
+ * @param[in,out] pool      pool
+ * @param[in] request_data  request data, possibly a block of the pool
+ */
+void RequestPool_Discard(struct RequestPool *const pool,
+			 const void *const request_data);
+
+/**
+ * @brief                   Returns the number of free blocks
+ *
+ * @param[in] pool          pool
+ *
+ * @return                  Number of blocks which can be allocated
+ */
+uint32_t RequestPool_GetFreeBlocksCount(const struct RequestPool *const pool);
+
+/**
+ * @brief                   Checks whether the buffer is a block of the pool
+ *
+ * @param[in] pool          pool
+ * @param[in] buffer        buffer to check
+ *
+ * @return                  Bool indicating whether the buffer belongs to
+ *                          the pool
+ */
+bool RequestPool_Contains(const struct RequestPool *const pool,
+			  const void *const buffer);
+
+/**
+ * @brief                   Marks the allocated block as passed to the
+ *                          receiver
+ *
+ * @param[in] pool          pool
+ * @param[in] buffer        buffer returned by RequestPool_Allocate
+ */
+void RequestPool_MarkQueued(const struct RequestPool *const pool,
+			    void *const buffer);
+
+/**
+ * @brief                   Checks, in debug builds, that the block was
+ *                          passed to the receiver
+ *
+ * @param[in] pool          pool
+ * @param[in] buffer        buffer received in a handle
+ */
+void RequestPool_AssertQueued(const struct RequestPool *const pool,
+			      const void *const buffer);
+
+/**
+ * @brief                   Initializes an empty FIFO of blocks
+ *
+ * @param[out] queue        queue to initialize
+ */
+void RequestPool_QueueInit(struct RequestPool_Queue *const queue);
+
+/**
+ * @brief                   Marks the allocated block as passed to the
+ *                          receiver and appends it to the FIFO
+ *
+ * @param[in] pool          pool
+ * @param[in,out] queue     queue
+ * @param[in] buffer        buffer returned by RequestPool_Allocate
+ * @param[in] size          size of the request data in the buffer
+ * @param[out] is_first     set if the queue was empty
+ */
+void RequestPool_Enqueue(const struct RequestPool *const pool,
+			 struct RequestPool_Queue *const queue,
+			 void *const buffer, const uint32_t size,
+			 bool *const is_first);
+
+/**
+ * @brief                   Takes the oldest block from the FIFO. The block
+ *                          stays queued until it is freed.
+ *
+ * @param[in,out] queue     queue
+ * @param[out] buffer       buffer of the block
+ * @param[out] size         size of the request data in the buffer
+ *
+ * @return                  Bool indicating whether the queue was not empty
+ */
+bool RequestPool_Dequeue(struct RequestPool_Queue *const queue,
+			 void **const buffer, uint32_t *const size);
+
+#endif
@@ -0,0 +1,102 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SpscRing.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Slot layout: message size, padding, message data
+#define SLOT_DATA_OFFSET (2u * sizeof(uint32_t))
+
+static inline uint8_t *get_slot(const struct SpscRing *const ring,
+				const uint32_t index)
+{
+	return ring->storage + (index % ring->slots_count) * ring->slot_size;
+}
+
+bool SpscRing_Init(struct SpscRing *const ring, void *const storage,
+		   const uint32_t message_size, const uint32_t slots_count)
+{
+	if (storage == NULL || slots_count == 0u ||
+	    (uintptr_t)storage % SPSC_RING_ALIGNMENT != 0u) {
+		return false;
+	}
+
+	ring->head = 0u;
+	ring->tail = 0u;
+	ring->storage = (uint8_t *)storage;
+	ring->message_size = message_size;
+	ring->slot_size = SPSC_RING_SLOT_SIZE(message_size);
+	ring->slots_count = slots_count;
+
+	return true;
+}
+
+bool SpscRing_Push(struct SpscRing *const ring, const void *const data,
+		   const uint32_t size, bool *const is_first)
+{
+	if (size > ring->message_size) {
+		return false;
+	}
+
+	const uint32_t tail = ring->tail;
+	if (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) >=
+	    ring->slots_count) {
+		return false;
+	}
+
+	uint8_t *const slot = get_slot(ring, tail);
+	memcpy(slot, &size, sizeof(size));
+	memcpy(slot + SLOT_DATA_OFFSET, data, size);
+	__atomic_store_n(&ring->tail, tail + 1u, __ATOMIC_SEQ_CST);
+
+	// The head is read after the tail is published, and the consumer
+	// reads the tail after the head is published, so either the consumer
+	// sees the new message, or the producer sees that it is the only one
+	*is_first = __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) == tail;
+	return true;
+}
+
+bool SpscRing_Peek(struct SpscRing *const ring, const void **const data,
+		   uint32_t *const size)
+{
+	const uint32_t head = ring->head;
+	if (__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+		return false;
+	}
+
+	const uint8_t *const slot = get_slot(ring, head);
+	memcpy(size, slot, sizeof(*size));
+	*data = slot + SLOT_DATA_OFFSET;
+	return true;
+}
+
+bool SpscRing_Release(struct SpscRing *const ring)
+{
+	const uint32_t head = ring->head + 1u;
+	__atomic_store_n(&ring->head, head, __ATOMIC_SEQ_CST);
+	return __atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST) == head;
+}
+
+uint32_t SpscRing_GetCount(const struct SpscRing *const ring)
+{
+	return __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) -
+	       __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+}
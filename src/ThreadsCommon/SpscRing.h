@@ -0,0 +1,133 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+/**
+ * @file    SpscRing.h
+ * @brief   Ring buffer of fixed-size slots with a single producer and
+ *          a single consumer.
+ *
+ * Push and pop are wait-free and do not disable interrupts. The indices
+ * written by the producer and by the consumer are placed in separate cache
+ * lines. The consumer accesses the oldest message in place and releases its
+ * slot afterwards, so messages are copied only once, by the producer. The
+ * storage is provided by the user.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPSC_RING_CACHE_LINE_SIZE 32u
+#define SPSC_RING_ALIGNMENT 8u
+
+/**
+ * @brief   Size of a slot holding messages of the given maximum size
+ */
+#define SPSC_RING_SLOT_SIZE(message_size)                                 \
+	(sizeof(uint32_t) + sizeof(uint32_t) +                            \
+	 (((message_size) + SPSC_RING_ALIGNMENT - 1u) &                   \
+	  ~(SPSC_RING_ALIGNMENT - 1u)))
+
+/**
+ * @brief   Size of the storage required by a ring of the given number of
+ *          slots, holding messages of the given maximum size
+ */
+#define SPSC_RING_STORAGE_SIZE(message_size, slots_count) \
+	((slots_count) * SPSC_RING_SLOT_SIZE(message_size))
+
+/**
+ * @brief   Struct representing the ring. Indices are free running and
+ *          wrap around at 2^32.
+ */
+struct SpscRing {
+	uint32_t head __attribute__((aligned(SPSC_RING_CACHE_LINE_SIZE)));
+	uint32_t tail __attribute__((aligned(SPSC_RING_CACHE_LINE_SIZE)));
+	uint8_t *storage __attribute__((aligned(SPSC_RING_CACHE_LINE_SIZE)));
+	uint32_t message_size;
+	uint32_t slot_size;
+	uint32_t slots_count;
+};
+
+/**
+ * @brief                   Initializes an empty ring
+ *
+ * @param[out] ring         ring to initialize
+ * @param[in] storage       storage of SPSC_RING_STORAGE_SIZE bytes, aligned
+ *                          to SPSC_RING_ALIGNMENT
+ * @param[in] message_size  maximum size of a message
+ * @param[in] slots_count   number of slots
+ *
+ * @return                  Bool indicating whether the initialization was
+ *                          successful
+ */
+bool SpscRing_Init(struct SpscRing *const ring, void *const storage,
+		   const uint32_t message_size, const uint32_t slots_count);
+
+/**
+ * @brief                   Copies the message into the ring. Called only by
+ *                          the producer.
+ *
+ * @param[in,out] ring      ring
+ * @param[in] data          message data
+ * @param[in] size          message size
+ * @param[out] is_first     set if the ring contained no other message after
+ *                          the push, i.e. the consumer may need a wakeup
+ *
+ * @return                  Bool indicating whether the message was pushed,
+ *                          false if the ring is full or the message too big
+ */
+bool SpscRing_Push(struct SpscRing *const ring, const void *const data,
+		   const uint32_t size, bool *const is_first);
+
+/**
+ * @brief                   Returns the oldest message, which stays in the
+ *                          ring until released. Called only by the consumer.
+ *
+ * @param[in] ring          ring
+ * @param[out] data         message data
+ * @param[out] size         message size
+ *
+ * @return                  Bool indicating whether there was a message
+ */
+bool SpscRing_Peek(struct SpscRing *const ring, const void **const data,
+		   uint32_t *const size);
+
+/**
+ * @brief                   Releases the slot of the oldest message. Called
+ *                          only by the consumer, after SpscRing_Peek.
+ *
+ * @param[in,out] ring      ring
+ *
+ * @return                  Bool indicating whether the ring is empty after
+ *                          the release
+ */
+bool SpscRing_Release(struct SpscRing *const ring);
+
+/**
+ * @brief                   Returns the number of messages in the ring
+ *
+ * @param[in] ring          ring
+ *
+ * @return                  Number of messages
+ */
+uint32_t SpscRing_GetCount(const struct SpscRing *const ring);
+
+#endif
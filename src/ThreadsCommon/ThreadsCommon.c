@@ -23,6 +23,7 @@
 #include <assert.h>
 #include <interfaces_info.h>
 #include <rtems.h>
+#include <rtems/score/threadimpl.h>
 #include <string.h>
 
 #ifdef RUNTIME_CYCLIC_INTERFACE_COUNT
@@ -31,53 +32,315 @@
 #define RT_MAX_CYCLIC_INTERFACES RUNTIME_THREAD_COUNT
 #endif
 
-extern rtems_name generate_new_partition_timer_name();
-static void schedule_next_tick(const uint32_t cyclic_request_data_index);
-static void timer_callback(rtems_id timer_id, void *cyclic_request_data_index);
+#ifndef RT_TRANSPORT_EVENT
+#define RT_TRANSPORT_EVENT RTEMS_EVENT_30
+#endif
+
+#ifndef RT_CYCLIC_RELEASE_EVENT
+#define RT_CYCLIC_RELEASE_EVENT RTEMS_EVENT_29
+#endif
+
+#ifndef RT_CYCLIC_RELEASE_HISTORY_SIZE
+#define RT_CYCLIC_RELEASE_HISTORY_SIZE 8
+#endif
+
+static void dispatch_cyclic_requests(void *arg);
 static void update_execution_time_data(const uint32_t thread_id,
-				       const uint64_t thread_execution_time);
+				       const uint64_t thread_execution_time,
+				       const uint64_t thread_cpu_time);
 
 typedef void (*call_function)(const char *buf, size_t len);
 
+struct CyclicRelease {
+	uint64_t planned_release_ns;
+	uint64_t actual_release_ns;
+};
+
 struct CyclicRequestData {
-	rtems_id timer_id;
-	rtems_interval next_wakeup_ticks;
-	rtems_interval interval_ticks;
+	uint64_t next_release_ns;
+	uint64_t interval_ns;
 	uint32_t queue_id;
 	uint32_t request_size;
+	uint32_t thread_id;
+	// Released with RT_CYCLIC_RELEASE_EVENT instead of the queue
+	bool is_event_mode;
+	// Releases sent to the queue, written by the dispatcher and read by
+	// the interface thread, indexed by the number of the release
+	uint32_t sent_releases_count;
+	uint32_t processed_releases_count;
+	struct CyclicRelease releases[RT_CYCLIC_RELEASE_HISTORY_SIZE];
 };
 
 static uint32_t cyclic_requests_count = 0;
 static struct CyclicRequestData cyclic_request_data[RT_MAX_CYCLIC_INTERFACES];
 static struct CyclicInterfaceEmptyRequestData empty_request;
 
-static void schedule_next_tick(const uint32_t cyclic_request_data_index)
+// Min-heap of indices of cyclic requests, ordered by the release time. Every
+// created cyclic request is always in the heap.
+static uint32_t release_heap[RT_MAX_CYCLIC_INTERFACES];
+static int32_t dispatcher_timer_id = 0;
+
+// Pools of interfaces receiving requests without copying
+static struct RequestPool request_pools[RUNTIME_THREAD_COUNT];
+static bool is_request_pool_created[RUNTIME_THREAD_COUNT];
+
+// Rings of interfaces using the ring transport instead of a message queue
+static struct SpscRing request_rings[RUNTIME_THREAD_COUNT];
+static bool is_request_ring_created[RUNTIME_THREAD_COUNT];
+
+// Mailboxes of interfaces interested only in the latest request
+static struct Mailbox request_mailboxes[RUNTIME_THREAD_COUNT];
+static bool is_request_mailbox_created[RUNTIME_THREAD_COUNT];
+
+// Priority lanes of interfaces with a request pool, linking the queued
+// blocks, the last lane has the highest priority
+struct RequestLanes {
+	struct RequestPool_Queue queues[RT_MAX_REQUEST_LANES];
+	uint32_t lanes_count;
+};
+
+static struct RequestLanes request_lanes[RUNTIME_THREAD_COUNT];
+
+// Index of the cyclic request increased by one, 0 for sporadic interfaces
+static uint32_t cyclic_request_of_thread[RUNTIME_THREAD_COUNT];
+
+// Cyclic interfaces released by an RTEMS rate monotonic period owned by
+// their thread, instead of the dispatcher. The release is written and read
+// by the interface thread only.
+struct CyclicPeriodData {
+	uint64_t interval_ns;
+	uint64_t offset_ns;
+	rtems_interval interval_ticks;
+	rtems_id period_id;
+	bool is_created;
+	bool is_release_pending;
+	struct CyclicRelease release;
+};
+
+static struct CyclicPeriodData cyclic_periods[RUNTIME_THREAD_COUNT];
+
+// Execution budgets of interfaces, enforced with a Hal timer armed for
+// every activation. The priority fields are written by the timer callback
+// and read by the interface thread after the timer is cancelled.
+struct ExecutionBudget {
+	uint64_t budget_ns;
+	int32_t timer_id;
+	uint32_t thread_id;
+	rtems_task_priority overrun_priority;
+	rtems_task_priority base_priority;
+	bool is_priority_lowered;
+};
+
+static struct ExecutionBudget execution_budgets[RUNTIME_THREAD_COUNT];
+
+static inline bool is_released_before(const uint32_t first_index,
+				      const uint32_t second_index)
+{
+	return cyclic_request_data[first_index].next_release_ns <
+	       cyclic_request_data[second_index].next_release_ns;
+}
+
+static void release_heap_sift_up(uint32_t position)
+{
+	while (position > 0u) {
+		const uint32_t parent = (position - 1u) / 2u;
+		if (!is_released_before(release_heap[position],
+					release_heap[parent])) {
+			break;
+		}
+		const uint32_t index = release_heap[position];
+		release_heap[position] = release_heap[parent];
+		release_heap[parent] = index;
+		position = parent;
+	}
+}
+
+static void release_heap_sift_down(uint32_t position)
+{
+	while (true) {
+		const uint32_t left = 2u * position + 1u;
+		const uint32_t right = left + 1u;
+		uint32_t earliest = position;
+
+		if (left < cyclic_requests_count &&
+		    is_released_before(release_heap[left],
+				       release_heap[earliest])) {
+			earliest = left;
+		}
+		if (right < cyclic_requests_count &&
+		    is_released_before(release_heap[right],
+				       release_heap[earliest])) {
+			earliest = right;
+		}
+		if (earliest == position) {
+			break;
+		}
+
+		const uint32_t index = release_heap[position];
+		release_heap[position] = release_heap[earliest];
+		release_heap[earliest] = index;
+		position = earliest;
+	}
+}
+
+static void advance_release_time(struct CyclicRequestData *const data,
+				 const uint64_t now_ns)
+{
+	data->next_release_ns += data->interval_ns;
+
+	// Releases missed because of a late interrupt are skipped, instead
+	// of being sent in a burst
+	if (data->next_release_ns <= now_ns) {
+		const uint64_t missed_releases =
+			(now_ns - data->next_release_ns) / data->interval_ns +
+			1u;
+		data->next_release_ns += missed_releases * data->interval_ns;
+	}
+}
+
+static void record_release(struct CyclicRequestData *const data,
+			   const uint64_t now_ns)
+{
+	// The oldest entry is overwritten if the thread is more than
+	// RT_CYCLIC_RELEASE_HISTORY_SIZE releases behind
+	struct CyclicRelease *const release =
+		&data->releases[data->sent_releases_count %
+				RT_CYCLIC_RELEASE_HISTORY_SIZE];
+	release->planned_release_ns = data->next_release_ns;
+	release->actual_release_ns = now_ns;
+	__atomic_fetch_add(&data->sent_releases_count, 1u, __ATOMIC_RELEASE);
+}
+
+static bool take_release(const uint32_t thread_id,
+			 struct CyclicRelease *const release,
+			 uint64_t *const interval_ns)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	struct CyclicPeriodData *const period = &cyclic_periods[thread_id];
+	if (period->is_release_pending) {
+		period->is_release_pending = false;
+		*release = period->release;
+		*interval_ns = period->interval_ns;
+		return true;
+	}
+
+	if (cyclic_request_of_thread[thread_id] == 0u) {
+		return false;
+	}
+
+	struct CyclicRequestData *const data =
+		&cyclic_request_data[cyclic_request_of_thread[thread_id] - 1u];
+	const uint32_t number = data->processed_releases_count;
+	if (__atomic_load_n(&data->sent_releases_count, __ATOMIC_ACQUIRE) ==
+	    number) {
+		return false;
+	}
+	data->processed_releases_count++;
+
+	*release = data->releases[number % RT_CYCLIC_RELEASE_HISTORY_SIZE];
+	*interval_ns = data->interval_ns;
+
+	// The entry is valid only if it was not overwritten before or during
+	// the copy. The dispatcher runs in an interrupt, so it completes the
+	// update of the entry before the copy is resumed.
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	return __atomic_load_n(&data->sent_releases_count, __ATOMIC_ACQUIRE) -
+		       number <=
+	       RT_CYCLIC_RELEASE_HISTORY_SIZE;
+}
+
+static void dispatch_cyclic_requests(void *arg)
+{
+	(void)arg;
+
+	// Called from the interrupt context. All releases which are due are
+	// sent in a single interrupt.
+	const uint64_t now_ns = Hal_GetElapsedTimeInNs();
+	while (cyclic_request_data[release_heap[0]].next_release_ns <= now_ns) {
+		struct CyclicRequestData *const data =
+			&cyclic_request_data[release_heap[0]];
+
+		if (data->is_event_mode) {
+			// Pending events merge, the number of releases is
+			// kept by the release history
+			if (rtems_event_send(threads_info[data->thread_id].id,
+					     RT_CYCLIC_RELEASE_EVENT) ==
+			    RTEMS_SUCCESSFUL) {
+				record_release(data, now_ns);
+			}
+		} else if (rtems_message_queue_send((rtems_id)data->queue_id,
+						    &empty_request,
+						    data->request_size) ==
+			   RTEMS_SUCCESSFUL) {
+			record_release(data, now_ns);
+			Monitor_IndicateRequestQueued(
+				(const enum interfaces_enum)data->thread_id);
+		}
+
+		advance_release_time(data, now_ns);
+		release_heap_sift_down(0u);
+	}
+
+	Hal_TimerFireAtNs(dispatcher_timer_id,
+			  cyclic_request_data[release_heap[0]].next_release_ns);
+}
+
+static struct RequestPool *get_request_pool(const uint32_t thread_id)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    !is_request_pool_created[thread_id]) {
+		return NULL;
+	}
+	return &request_pools[thread_id];
+}
+
+static struct SpscRing *get_request_ring(const uint32_t thread_id)
 {
-	const rtems_id timer_id =
-		cyclic_request_data[cyclic_request_data_index].timer_id;
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    !is_request_ring_created[thread_id]) {
+		return NULL;
+	}
+	return &request_rings[thread_id];
+}
 
-	cyclic_request_data[cyclic_request_data_index].next_wakeup_ticks +=
-		cyclic_request_data[cyclic_request_data_index].interval_ticks;
-	rtems_interval delta = cyclic_request_data[cyclic_request_data_index]
-				       .next_wakeup_ticks -
-			       rtems_clock_get_ticks_since_boot();
-	rtems_timer_fire_after(timer_id, delta, timer_callback,
-			       (void *)cyclic_request_data_index);
+static struct Mailbox *get_request_mailbox(const uint32_t thread_id)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    !is_request_mailbox_created[thread_id]) {
+		return NULL;
+	}
+	return &request_mailboxes[thread_id];
 }
 
-static void timer_callback(rtems_id timer_id, void *cyclic_request_data_index)
+static struct RequestLanes *get_request_lanes(const uint32_t thread_id)
 {
-	uintptr_t index = (uintptr_t)cyclic_request_data_index;
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    request_lanes[thread_id].lanes_count == 0u) {
+		return NULL;
+	}
+	return &request_lanes[thread_id];
+}
 
-	rtems_message_queue_send((rtems_id)cyclic_request_data[index].queue_id,
-				 &empty_request,
-				 cyclic_request_data[index].request_size);
+static bool has_transport(const uint32_t thread_id)
+{
+	return is_request_pool_created[thread_id] ||
+	       is_request_ring_created[thread_id] ||
+	       is_request_mailbox_created[thread_id];
+}
 
-	schedule_next_tick(index);
+static uint64_t get_cpu_time_used(void)
+{
+	const Timestamp_Control cpu_time =
+		_Thread_Get_CPU_time_used(_Thread_Get_executing());
+	return _Timestamp_Get_as_nanoseconds(&cpu_time);
 }
 
 static void update_execution_time_data(const uint32_t thread_id,
-				       const uint64_t thread_execution_time)
+				       const uint64_t thread_execution_time,
+				       const uint64_t thread_cpu_time)
 {
 	if (thread_execution_time <
 	    threads_info[thread_id].min_thread_execution_time) {
@@ -91,16 +354,156 @@ static void update_execution_time_data(const uint32_t thread_id,
 			thread_execution_time;
 	}
 
-	threads_info[thread_id].mean_thread_execution_time =
-		threads_info[thread_id].mean_thread_execution_time +
-		((double)thread_execution_time -
-		 threads_info[thread_id].mean_thread_execution_time) /
-			((double)threads_info[thread_id].execution_time_counter +
-			 1);
+	// The mean is derived from integer statistics kept by the Monitor,
+	// so no floating point operation is done on the activation path
+	Monitor_IndicateInterfaceExecutionTime(
+		(const enum interfaces_enum)thread_id, thread_execution_time,
+		thread_cpu_time);
 
 	threads_info[thread_id].execution_time_counter++;
 }
 
+static void handle_budget_overrun(void *arg)
+{
+	struct ExecutionBudget *const budget = (struct ExecutionBudget *)arg;
+
+	Monitor_IndicateBudgetOverrun(
+		(const enum interfaces_enum)budget->thread_id,
+		budget->budget_ns);
+
+	if (budget->overrun_priority != RTEMS_CURRENT_PRIORITY) {
+		rtems_task_priority previous_priority;
+		if (rtems_task_set_priority(threads_info[budget->thread_id].id,
+					    budget->overrun_priority,
+					    &previous_priority) ==
+		    RTEMS_SUCCESSFUL) {
+			budget->is_priority_lowered = true;
+		}
+	}
+}
+
+static void start_budget(const uint32_t thread_id)
+{
+	struct ExecutionBudget *const budget = &execution_budgets[thread_id];
+	if (budget->budget_ns == 0u) {
+		return;
+	}
+
+	// The real priority, without inherited boosts, is taken by the thread
+	// itself, so it also follows changes made between activations
+	if (budget->overrun_priority != RTEMS_CURRENT_PRIORITY) {
+		rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY,
+					&budget->base_priority);
+	}
+
+	Hal_TimerFireAtNs(budget->timer_id,
+			  Hal_GetElapsedTimeInNs() + budget->budget_ns);
+}
+
+static void stop_budget(const uint32_t thread_id)
+{
+	struct ExecutionBudget *const budget = &execution_budgets[thread_id];
+	if (budget->budget_ns == 0u) {
+		return;
+	}
+
+	Hal_TimerCancel(budget->timer_id);
+
+	// The callback cannot run after the timer is cancelled, so the
+	// priority can be restored without a race. A priority set by the user
+	// function after the overrun is kept.
+	if (budget->is_priority_lowered) {
+		rtems_task_priority current_priority;
+		if (rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY,
+					    &current_priority) ==
+			    RTEMS_SUCCESSFUL &&
+		    current_priority == budget->overrun_priority) {
+			rtems_task_set_priority(RTEMS_SELF,
+						budget->base_priority,
+						&current_priority);
+		}
+		budget->is_priority_lowered = false;
+	}
+}
+
+bool ThreadsCommon_SetExecutionBudget(const uint32_t thread_id,
+				      const uint64_t budget_ns,
+				      const uint32_t overrun_priority)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT) {
+		return false;
+	}
+
+	struct ExecutionBudget *const budget = &execution_budgets[thread_id];
+	if (budget->timer_id == 0) {
+		budget->timer_id = Hal_TimerCreate(handle_budget_overrun, budget);
+		if (budget->timer_id == 0) {
+			return false;
+		}
+	}
+
+	budget->thread_id = thread_id;
+	budget->overrun_priority = (rtems_task_priority)overrun_priority;
+	budget->budget_ns = budget_ns;
+	return true;
+}
+
+static bool add_cyclic_request(const uint64_t interval_ns,
+			       const uint64_t dispatch_offset_ns,
+			       const uint32_t queue_id,
+			       const uint32_t request_size,
+			       const uint32_t thread_id, const bool is_event_mode)
+{
+	if (cyclic_requests_count >= RT_MAX_CYCLIC_INTERFACES) {
+		return false;
+	}
+
+	if (interval_ns == 0u) {
+		return false;
+	}
+
+	if (dispatcher_timer_id == 0) {
+		dispatcher_timer_id =
+			Hal_TimerCreate(dispatch_cyclic_requests, NULL);
+		if (dispatcher_timer_id == 0) {
+			return false;
+		}
+	}
+
+	const uint32_t index = cyclic_requests_count;
+	struct CyclicRequestData *const data = &cyclic_request_data[index];
+	data->next_release_ns = dispatch_offset_ns + interval_ns;
+	data->interval_ns = interval_ns;
+	data->queue_id = queue_id;
+	data->request_size = request_size;
+	data->sent_releases_count = 0u;
+	data->processed_releases_count = 0u;
+	data->thread_id = thread_id;
+	data->is_event_mode = is_event_mode;
+
+	if (thread_id < RUNTIME_THREAD_COUNT) {
+		cyclic_request_of_thread[thread_id] = index + 1u;
+	}
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	release_heap[index] = index;
+	cyclic_requests_count++;
+	release_heap_sift_up(index);
+	if (release_heap[0] == index) {
+		Hal_TimerFireAtNs(dispatcher_timer_id, data->next_release_ns);
+	}
+	rtems_interrupt_local_enable(level);
+
+	return true;
+}
+
+static bool is_released_by_event(const uint32_t thread_id)
+{
+	const uint32_t request = cyclic_request_of_thread[thread_id];
+	return request != 0u && cyclic_request_data[request - 1u].is_event_mode;
+}
+
 bool ThreadsCommon_CreateCyclicRequest(const uint64_t interval_ns,
 				       const uint64_t dispatch_offset_ns,
 				       const uint32_t queue_id,
@@ -109,29 +512,412 @@ bool ThreadsCommon_CreateCyclicRequest(const uint64_t interval_ns,
 	assert(request_size <= sizeof(struct CyclicInterfaceEmptyRequestData));
 	memset(empty_request.m_data, 0, EMPTY_REQUEST_DATA_BUFFER_SIZE);
 
-	if (cyclic_requests_count >= RT_MAX_CYCLIC_INTERFACES) {
+	uint32_t receiving_thread_id = RUNTIME_THREAD_COUNT;
+	for (uint32_t thread_id = 0; thread_id < RUNTIME_THREAD_COUNT;
+	     thread_id++) {
+		if (interface_to_queue_map[thread_id] == (rtems_id)queue_id) {
+			receiving_thread_id = thread_id;
+		}
+	}
+
+	// Cyclic requests are sent as raw data to the message queue, which
+	// interfaces with a pool, a ring or a mailbox do not receive from
+	if (receiving_thread_id < RUNTIME_THREAD_COUNT &&
+	    has_transport(receiving_thread_id)) {
 		return false;
 	}
 
-	rtems_name name = generate_new_partition_timer_name();
-	const rtems_status_code timer_creation_status = rtems_timer_create(
-		name, &cyclic_request_data[cyclic_requests_count].timer_id);
-	if (timer_creation_status != RTEMS_SUCCESSFUL) {
+	// A thread is released either by its queue, by events or by a rate
+	// monotonic period, several cyclic requests may share the queue
+	if (receiving_thread_id < RUNTIME_THREAD_COUNT &&
+	    (cyclic_periods[receiving_thread_id].interval_ticks != 0u ||
+	     is_released_by_event(receiving_thread_id))) {
 		return false;
 	}
 
-	cyclic_request_data[cyclic_requests_count].next_wakeup_ticks =
-		RTEMS_MILLISECONDS_TO_TICKS(dispatch_offset_ns /
-					    NANOSECONDS_IN_MILLISECOND);
-	cyclic_request_data[cyclic_requests_count].interval_ticks =
-		RTEMS_MILLISECONDS_TO_TICKS(interval_ns /
-					    NANOSECONDS_IN_MILLISECOND);
-	cyclic_request_data[cyclic_requests_count].queue_id = queue_id;
-	cyclic_request_data[cyclic_requests_count].request_size = request_size;
+	return add_cyclic_request(interval_ns, dispatch_offset_ns, queue_id,
+				  request_size, receiving_thread_id, false);
+}
 
-	schedule_next_tick(cyclic_requests_count);
+bool ThreadsCommon_CreateCyclicEventRequest(const uint32_t thread_id,
+					    const uint64_t interval_ns,
+					    const uint64_t dispatch_offset_ns)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    cyclic_request_of_thread[thread_id] != 0u ||
+	    cyclic_periods[thread_id].interval_ticks != 0u) {
+		return false;
+	}
 
-	cyclic_requests_count++;
+	return add_cyclic_request(interval_ns, dispatch_offset_ns, 0u, 0u,
+				  thread_id, true);
+}
+
+bool ThreadsCommon_WaitForCyclicEvent(const uint32_t thread_id)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    cyclic_request_of_thread[thread_id] == 0u) {
+		return false;
+	}
+
+	struct CyclicRequestData *const data =
+		&cyclic_request_data[cyclic_request_of_thread[thread_id] - 1u];
+	if (!data->is_event_mode) {
+		return false;
+	}
+
+	// An event may be left from releases already taken with a previous
+	// event, it causes one extra pass of the loop
+	uint32_t pending_releases_count = 0u;
+	while (pending_releases_count == 0u) {
+		rtems_event_set events;
+		if (rtems_event_receive(RT_CYCLIC_RELEASE_EVENT,
+					RTEMS_EVENT_ANY | RTEMS_WAIT,
+					RTEMS_NO_TIMEOUT,
+					&events) != RTEMS_SUCCESSFUL) {
+			return false;
+		}
+		pending_releases_count =
+			__atomic_load_n(&data->sent_releases_count,
+					__ATOMIC_ACQUIRE) -
+			data->processed_releases_count;
+	}
+
+	// Releases which happened before the thread woke up are coalesced
+	// into a single activation, timed from the latest release
+	if (pending_releases_count > 1u) {
+		data->processed_releases_count += pending_releases_count - 1u;
+		Monitor_IndicateReleasesCoalesced(
+			(const enum interfaces_enum)thread_id,
+			pending_releases_count - 1u);
+	}
+
+	return true;
+}
+
+bool ThreadsCommon_CreateCyclicPeriod(const uint32_t thread_id,
+				      const uint64_t interval_ns,
+				      const uint64_t dispatch_offset_ns)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    cyclic_request_of_thread[thread_id] != 0u ||
+	    cyclic_periods[thread_id].interval_ticks != 0u) {
+		return false;
+	}
+
+	// Periods are counted in clock ticks, the interval is rounded to the
+	// nearest tick, so the planned releases follow the actual ones
+	const uint64_t tick_ns =
+		(uint64_t)rtems_configuration_get_microseconds_per_tick() *
+		1000u;
+	const uint64_t interval_ticks = (interval_ns + tick_ns / 2u) / tick_ns;
+	if (interval_ticks == 0u || interval_ticks > UINT32_MAX) {
+		return false;
+	}
+
+	struct CyclicPeriodData *const period = &cyclic_periods[thread_id];
+	period->interval_ns = interval_ticks * tick_ns;
+	period->offset_ns = dispatch_offset_ns;
+	period->interval_ticks = (rtems_interval)interval_ticks;
+	period->is_created = false;
+	period->is_release_pending = false;
+	return true;
+}
+
+bool ThreadsCommon_WaitForCyclicRelease(const uint32_t thread_id)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    cyclic_periods[thread_id].interval_ticks == 0u) {
+		return false;
+	}
+
+	struct CyclicPeriodData *const period = &cyclic_periods[thread_id];
+	if (!period->is_created) {
+		// A period can be used only by the thread which created it
+		if (rtems_rate_monotonic_create(
+			    rtems_build_name('P', 'E', 'R', 'D'),
+			    &period->period_id) != RTEMS_SUCCESSFUL) {
+			return false;
+		}
+		period->is_created = true;
+		Monitor_IndicatePeriodCreated(
+			(const enum interfaces_enum)thread_id,
+			period->period_id);
+
+		// The first release happens at offset + interval, as for the
+		// dispatcher, and starts the period
+		period->release.planned_release_ns =
+			period->offset_ns + period->interval_ns;
+		if (!Hal_SleepUntilNs(period->release.planned_release_ns)) {
+			return false;
+		}
+	} else {
+		period->release.planned_release_ns += period->interval_ns;
+	}
+
+	// Timeout means that the previous period already ended, RTEMS counts
+	// it as missed and the thread is released immediately
+	const rtems_status_code result = rtems_rate_monotonic_period(
+		period->period_id, period->interval_ticks);
+	if (result != RTEMS_SUCCESSFUL && result != RTEMS_TIMEOUT) {
+		return false;
+	}
+
+	period->release.actual_release_ns = Hal_GetElapsedTimeInNs();
+	period->is_release_pending = true;
+	return true;
+}
+
+bool ThreadsCommon_PlanCyclicOffsets(const uint64_t *const wcets_ns,
+				     const uint64_t granularity_ns)
+{
+	static struct OffsetPlanner_Interface planned[RT_MAX_CYCLIC_INTERFACES];
+
+	const uint32_t count = cyclic_requests_count;
+	for (uint32_t i = 0u; i < count; i++) {
+		const uint32_t thread_id = cyclic_request_data[i].thread_id;
+		planned[i].period_ns = cyclic_request_data[i].interval_ns;
+		planned[i].wcet_ns = 0u;
+		if (thread_id < RUNTIME_THREAD_COUNT) {
+			planned[i].wcet_ns =
+				wcets_ns != NULL ?
+					wcets_ns[thread_id] :
+					threads_info[thread_id]
+						.max_thread_execution_time;
+		}
+	}
+
+	if (!OffsetPlanner_Plan(planned, count, granularity_ns)) {
+		return false;
+	}
+
+	// All offsets are applied from a common time, so the releases keep
+	// the planned phases relative to each other
+	const uint64_t now = Hal_GetElapsedTimeInNs();
+
+	rtems_interrupt_level level;
+	rtems_interrupt_local_disable(level);
+	for (uint32_t i = 0u; i < count; i++) {
+		cyclic_request_data[i].next_release_ns =
+			now + planned[i].offset_ns + planned[i].period_ns;
+		release_heap[i] = i;
+	}
+	for (uint32_t i = count / 2u; i > 0u; i--) {
+		release_heap_sift_down(i - 1u);
+	}
+	if (count > 0u) {
+		Hal_TimerFireAtNs(
+			dispatcher_timer_id,
+			cyclic_request_data[release_heap[0]].next_release_ns);
+	}
+	rtems_interrupt_local_enable(level);
+
+	return true;
+}
+
+bool ThreadsCommon_CreateRequestPool(const uint32_t thread_id,
+				     void *const storage,
+				     const uint32_t block_size,
+				     const uint32_t blocks_count)
+{
+	// Cyclic requests are queued as raw data, not as handles
+	if (thread_id >= RUNTIME_THREAD_COUNT || has_transport(thread_id) ||
+	    cyclic_request_of_thread[thread_id] != 0u) {
+		return false;
+	}
+
+	if (!RequestPool_Init(&request_pools[thread_id], storage, block_size,
+			      blocks_count)) {
+		return false;
+	}
+
+	is_request_pool_created[thread_id] = true;
+	return true;
+}
+
+bool ThreadsCommon_CreateRingTransport(const uint32_t thread_id,
+				       void *const storage,
+				       const uint32_t message_size,
+				       const uint32_t slots_count)
+{
+	// Cyclic requests are sent to the message queue, which is not
+	// received from anymore
+	if (thread_id >= RUNTIME_THREAD_COUNT || has_transport(thread_id) ||
+	    cyclic_request_of_thread[thread_id] != 0u) {
+		return false;
+	}
+
+	if (!SpscRing_Init(&request_rings[thread_id], storage, message_size,
+			   slots_count)) {
+		return false;
+	}
+
+	is_request_ring_created[thread_id] = true;
+	Monitor_IndicateInterfaceQueueCreated(
+		(const enum interfaces_enum)thread_id);
+	return true;
+}
+
+bool ThreadsCommon_CreateMailboxTransport(const uint32_t thread_id,
+					  void *const storage,
+					  const uint32_t message_size)
+{
+	// Cyclic requests are sent to the message queue, which is not
+	// received from anymore
+	if (thread_id >= RUNTIME_THREAD_COUNT || has_transport(thread_id) ||
+	    cyclic_request_of_thread[thread_id] != 0u) {
+		return false;
+	}
+
+	if (!Mailbox_Init(&request_mailboxes[thread_id], storage,
+			  message_size)) {
+		return false;
+	}
+
+	is_request_mailbox_created[thread_id] = true;
+	Monitor_IndicateInterfaceQueueCreated(
+		(const enum interfaces_enum)thread_id);
+	return true;
+}
+
+bool ThreadsCommon_CreateRequestLanes(const uint32_t thread_id,
+				      const uint32_t lanes_count)
+{
+	if (thread_id >= RUNTIME_THREAD_COUNT ||
+	    !is_request_pool_created[thread_id] ||
+	    request_lanes[thread_id].lanes_count != 0u || lanes_count == 0u ||
+	    lanes_count > RT_MAX_REQUEST_LANES) {
+		return false;
+	}
+
+	for (uint32_t lane = 0u; lane < lanes_count; lane++) {
+		RequestPool_QueueInit(&request_lanes[thread_id].queues[lane]);
+	}
+	request_lanes[thread_id].lanes_count = lanes_count;
+	Monitor_IndicateInterfaceQueueCreated(
+		(const enum interfaces_enum)thread_id);
+	return true;
+}
+
+static bool take_lane_request(struct RequestLanes *const lanes,
+			      const uint32_t thread_id,
+			      const void **const request_data,
+			      uint32_t *const request_size)
+{
+	for (uint32_t lane = lanes->lanes_count; lane > 0u; lane--) {
+		void *buffer;
+		if (RequestPool_Dequeue(&lanes->queues[lane - 1u], &buffer,
+					request_size)) {
+			Monitor_IndicateLaneRequestDequeued(
+				(const enum interfaces_enum)thread_id,
+				lane - 1u);
+			*request_data = buffer;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool peek_request(const uint32_t thread_id,
+			 const void **const request_data,
+			 uint32_t *const request_size)
+{
+	struct SpscRing *const ring = get_request_ring(thread_id);
+	if (ring != NULL) {
+		return SpscRing_Peek(ring, request_data, request_size);
+	}
+
+	struct Mailbox *const mailbox = get_request_mailbox(thread_id);
+	if (mailbox != NULL) {
+		return Mailbox_Read(mailbox, request_data, request_size);
+	}
+
+	struct RequestLanes *const lanes = get_request_lanes(thread_id);
+	if (lanes != NULL) {
+		return take_lane_request(lanes, thread_id, request_data,
+					 request_size);
+	}
+
+	return false;
+}
+
+bool ThreadsCommon_ReceiveRequest(const uint32_t thread_id,
+				  const void **const request_data,
+				  uint32_t *const request_size)
+{
+	if (get_request_ring(thread_id) == NULL &&
+	    get_request_mailbox(thread_id) == NULL &&
+	    get_request_lanes(thread_id) == NULL) {
+		return false;
+	}
+
+	// The producer sends the event only when the ring or a lane becomes
+	// non-empty, or the mailbox gets a value after the previous one was
+	// read, an event left from an already consumed request causes one
+	// extra pass of the loop
+	while (!peek_request(thread_id, request_data, request_size)) {
+		rtems_event_set events;
+		if (rtems_event_receive(RT_TRANSPORT_EVENT,
+					RTEMS_EVENT_ANY | RTEMS_WAIT,
+					RTEMS_NO_TIMEOUT,
+					&events) != RTEMS_SUCCESSFUL) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void *ThreadsCommon_AllocateRequest(const uint32_t thread_id)
+{
+	struct RequestPool *const pool = get_request_pool(thread_id);
+	if (pool == NULL) {
+		return NULL;
+	}
+
+	return RequestPool_Allocate(pool);
+}
+
+bool ThreadsCommon_FreeRequest(const uint32_t thread_id, void *const buffer)
+{
+	struct RequestPool *const pool = get_request_pool(thread_id);
+	if (pool == NULL || !RequestPool_Contains(pool, buffer)) {
+		return false;
+	}
+
+	RequestPool_Free(pool, buffer);
+	return true;
+}
+
+static bool unpack_request(const struct RequestPool *const pool,
+			   const struct RequestLanes *const lanes,
+			   const void **const data, uint32_t *const size)
+{
+	// Interfaces with a pool receive handles of the requests, unless
+	// the requests are passed through lanes
+	if (pool == NULL) {
+		return true;
+	}
+	if (lanes != NULL) {
+		RequestPool_AssertQueued(pool, *data);
+		return true;
+	}
+
+	// The queue may be written by anyone holding its ID, so a handle is
+	// validated before the buffer it points to is used or freed
+	struct RequestPool_Handle handle;
+	if (*size != sizeof(handle)) {
+		return false;
+	}
+	memcpy(&handle, *data, sizeof(handle));
+	if (!RequestPool_Contains(pool, handle.buffer) ||
+	    handle.size > pool->block_size) {
+		return false;
+	}
+	RequestPool_AssertQueued(pool, handle.buffer);
+	*data = handle.buffer;
+	*size = handle.size;
 	return true;
 }
 
@@ -141,43 +927,413 @@ bool ThreadsCommon_ProcessRequest(const void *const request_data,
 {
 	call_function cast_user_function = (call_function)user_function;
 
+	struct RequestPool *const pool = get_request_pool(thread_id);
+	const void *data = request_data;
+	uint32_t size = request_size;
+	const bool is_valid = unpack_request(pool, get_request_lanes(thread_id),
+					     &data, &size);
+
+	Monitor_IndicateRequestDequeued((const enum interfaces_enum)thread_id);
+	if (!is_valid) {
+		return false;
+	}
 	Monitor_IndicateInterfaceActivated((const enum interfaces_enum)thread_id);
 
+	start_budget(thread_id);
+	const uint64_t cpu_time_before_execution = get_cpu_time_used();
 	const uint64_t time_before_execution = Hal_GetElapsedTimeInNs();
-	cast_user_function((const char *)request_data, request_size);
+	cast_user_function((const char *)data, size);
 	const uint64_t time_after_execution = Hal_GetElapsedTimeInNs();
+	const uint64_t cpu_time_after_execution = get_cpu_time_used();
+	stop_budget(thread_id);
+
+	if (pool != NULL) {
+		RequestPool_Free(pool, (void *)data);
+	}
+
+	// Requests of the ring transport are processed in place
+	struct SpscRing *const ring = get_request_ring(thread_id);
+	if (ring != NULL) {
+		SpscRing_Release(ring);
+	}
 
 	Monitor_IndicateInterfaceDeactivated((const enum interfaces_enum)thread_id);
 
 	threads_info[thread_id].thread_execution_time =
 		time_after_execution - time_before_execution;
 	update_execution_time_data(
-		thread_id, threads_info[thread_id].thread_execution_time);
+		thread_id, threads_info[thread_id].thread_execution_time,
+		cpu_time_after_execution - cpu_time_before_execution);
+
+	struct CyclicRelease release;
+	uint64_t interval_ns;
+	if (take_release(thread_id, &release, &interval_ns)) {
+		Monitor_IndicateCyclicActivationTiming(
+			(const enum interfaces_enum)thread_id,
+			release.planned_release_ns, release.actual_release_ns,
+			time_before_execution, time_after_execution,
+			interval_ns);
+	}
 
 	return true;
 }
 
+bool ThreadsCommon_ProcessRequestBatch(void *const request_buffer,
+				       const uint32_t request_size,
+				       const uint32_t queue_id,
+				       void *user_function,
+				       const uint32_t thread_id,
+				       const uint32_t max_requests_count)
+{
+	call_function cast_user_function = (call_function)user_function;
+	struct RequestPool *const pool = get_request_pool(thread_id);
+	struct SpscRing *const ring = get_request_ring(thread_id);
+	struct RequestLanes *const lanes = get_request_lanes(thread_id);
+	const bool is_queue_transport = ring == NULL && lanes == NULL &&
+					get_request_mailbox(thread_id) == NULL;
+
+	const void *data = request_buffer;
+	uint32_t data_size = request_size;
+	if (!unpack_request(pool, lanes, &data, &data_size)) {
+		Monitor_IndicateRequestDequeued(
+			(const enum interfaces_enum)thread_id);
+		return false;
+	}
+
+	Monitor_IndicateInterfaceActivated((const enum interfaces_enum)thread_id);
+
+	const uint64_t cpu_time_before_execution = get_cpu_time_used();
+	const uint64_t time_before_execution = Hal_GetElapsedTimeInNs();
+	uint32_t processed_requests_count = 0u;
+	bool is_successful = true;
+	bool is_pending = true;
+	while (is_pending) {
+		Monitor_IndicateRequestDequeued(
+			(const enum interfaces_enum)thread_id);
+
+		// Every cyclic request corresponds to one release, so requests
+		// of cyclic interfaces are timed one by one
+		struct CyclicRelease release;
+		uint64_t interval_ns;
+		const bool is_released =
+			take_release(thread_id, &release, &interval_ns);
+		const uint64_t request_start_ns =
+			is_released ? Hal_GetElapsedTimeInNs() : 0u;
+
+		// Each request of the batch has the whole budget
+		start_budget(thread_id);
+		cast_user_function((const char *)data, data_size);
+		stop_budget(thread_id);
+
+		if (is_released) {
+			Monitor_IndicateCyclicActivationTiming(
+				(const enum interfaces_enum)thread_id,
+				release.planned_release_ns,
+				release.actual_release_ns, request_start_ns,
+				Hal_GetElapsedTimeInNs(), interval_ns);
+		}
+
+		if (pool != NULL) {
+			RequestPool_Free(pool, (void *)data);
+		}
+		// Requests of the ring transport are processed in place
+		if (ring != NULL) {
+			SpscRing_Release(ring);
+		}
+		processed_requests_count++;
+
+		if (processed_requests_count >= max_requests_count) {
+			is_pending = false;
+		} else if (!is_queue_transport) {
+			// A mailbox holds at most one value, which is pending
+			// only if it was written during the batch
+			is_pending = peek_request(thread_id, &data, &data_size);
+		} else {
+			size_t size;
+			is_pending = rtems_message_queue_receive(
+					     (rtems_id)queue_id, request_buffer,
+					     &size, RTEMS_NO_WAIT,
+					     RTEMS_NO_TIMEOUT) ==
+				     RTEMS_SUCCESSFUL;
+			data = request_buffer;
+			data_size = (uint32_t)size;
+		}
+
+		// An invalid handle ends the batch, the request is dropped
+		if (is_pending &&
+		    !unpack_request(pool, lanes, &data, &data_size)) {
+			Monitor_IndicateRequestDequeued(
+				(const enum interfaces_enum)thread_id);
+			is_pending = false;
+			is_successful = false;
+		}
+	}
+	const uint64_t time_after_execution = Hal_GetElapsedTimeInNs();
+	const uint64_t cpu_time_after_execution = get_cpu_time_used();
+
+	Monitor_IndicateInterfaceBatchDeactivated(
+		(const enum interfaces_enum)thread_id,
+		processed_requests_count);
+
+	// Requests of the batch are not timed separately, each of them is
+	// accounted with the average execution and CPU time of the batch
+	threads_info[thread_id].thread_execution_time =
+		(time_after_execution - time_before_execution) /
+		processed_requests_count;
+	update_execution_time_data(
+		thread_id, threads_info[thread_id].thread_execution_time,
+		(cpu_time_after_execution - cpu_time_before_execution) /
+			processed_requests_count);
+
+	return is_successful;
+}
+
+static rtems_status_code put_in_queue(const uint32_t queue_id,
+				      const void *const data,
+				      const size_t size, const bool is_urgent)
+{
+	if (is_urgent) {
+		return rtems_message_queue_urgent((rtems_id)queue_id, data,
+						  size);
+	}
+	return rtems_message_queue_send((rtems_id)queue_id, data, size);
+}
+
+static rtems_status_code take_pool_block(struct RequestPool *const pool,
+					 const void *const request_data,
+					 const uint32_t request_size,
+					 void **const buffer)
+{
+	// A request filled in place is owned by the runtime whatever the
+	// result, RequestPool_Take frees it when it is too big
+	const bool is_too_big = request_size > pool->block_size;
+	*buffer = RequestPool_Take(pool, request_data, request_size);
+	if (*buffer == NULL) {
+		return is_too_big ? RTEMS_INVALID_SIZE : RTEMS_TOO_MANY;
+	}
+
+	return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code send_pooled_request(struct RequestPool *const pool,
+					     const void *const request_data,
+					     const uint32_t request_size,
+					     const uint32_t queue_id,
+					     const bool is_urgent,
+					     bool *const is_queued)
+{
+	void *buffer;
+	rtems_status_code result =
+		take_pool_block(pool, request_data, request_size, &buffer);
+	if (result != RTEMS_SUCCESSFUL) {
+		return result;
+	}
+
+	RequestPool_MarkQueued(pool, buffer);
+	const struct RequestPool_Handle handle = {
+		.buffer = buffer,
+		.size = request_size,
+	};
+	result = put_in_queue(queue_id, &handle, sizeof(handle), is_urgent);
+	*is_queued = result == RTEMS_SUCCESSFUL;
+	if (!*is_queued) {
+		RequestPool_Free(pool, buffer);
+	}
+
+	return result;
+}
+
+static rtems_status_code send_lane_request(struct RequestPool *const pool,
+					   struct RequestLanes *const lanes,
+					   const void *const request_data,
+					   const uint32_t request_size,
+					   const uint32_t thread_id,
+					   const uint32_t lane,
+					   bool *const is_queued)
+{
+	if (lane >= lanes->lanes_count) {
+		RequestPool_Discard(pool, request_data);
+		return RTEMS_INVALID_NUMBER;
+	}
+
+	void *buffer;
+	const rtems_status_code result =
+		take_pool_block(pool, request_data, request_size, &buffer);
+	if (result != RTEMS_SUCCESSFUL) {
+		return result;
+	}
+
+	// Counted before the request becomes visible to the consumer, which
+	// may dequeue it at once, the enqueue itself cannot fail
+	Monitor_IndicateLaneRequestQueued((const enum interfaces_enum)thread_id,
+					  lane);
+	bool is_first;
+	RequestPool_Enqueue(pool, &lanes->queues[lane], buffer, request_size,
+			    &is_first);
+	*is_queued = true;
+
+	// The consumer may be waiting only if all lanes were empty, which
+	// implies that this lane was empty
+	if (is_first) {
+		return rtems_event_send(threads_info[thread_id].id,
+					RT_TRANSPORT_EVENT);
+	}
+
+	return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code send_ring_request(struct SpscRing *const ring,
+					   const void *const request_data,
+					   const uint32_t request_size,
+					   const uint32_t thread_id,
+					   bool *const is_queued)
+{
+	if (request_size > ring->message_size) {
+		return RTEMS_INVALID_SIZE;
+	}
+
+	bool is_first;
+	if (!SpscRing_Push(ring, request_data, request_size, &is_first)) {
+		return RTEMS_TOO_MANY;
+	}
+	*is_queued = true;
+
+	// The consumer may be waiting only if the ring was empty
+	if (is_first) {
+		return rtems_event_send(threads_info[thread_id].id,
+					RT_TRANSPORT_EVENT);
+	}
+
+	return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code send_mailbox_request(struct Mailbox *const mailbox,
+					      const void *const request_data,
+					      const uint32_t request_size,
+					      const uint32_t thread_id,
+					      bool *const is_queued)
+{
+	bool is_first;
+	if (!Mailbox_Write(mailbox, request_data, request_size, &is_first)) {
+		return RTEMS_INVALID_SIZE;
+	}
+
+	// A value overwriting one not read yet replaces it, it is not queued
+	// and does not activate the consumer again
+	*is_queued = is_first;
+	if (is_first) {
+		return rtems_event_send(threads_info[thread_id].id,
+					RT_TRANSPORT_EVENT);
+	}
+
+	return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code send_request(const void *const request_data,
+				      const uint32_t request_size,
+				      const uint32_t queue_id,
+				      const uint32_t thread_id,
+				      const uint32_t priority)
+{
+	rtems_status_code result;
+	bool is_queued = false;
+	struct RequestPool *const pool = get_request_pool(thread_id);
+	struct SpscRing *const ring = get_request_ring(thread_id);
+	struct Mailbox *const mailbox = get_request_mailbox(thread_id);
+	struct RequestLanes *const lanes = get_request_lanes(thread_id);
+
+	// The receiver may dequeue the request as soon as it is published, so
+	// it is counted in advance. The count is rolled back unless the
+	// request ended up in the transport, even if waking up the receiver
+	// failed afterwards.
+	Monitor_IndicateRequestQueued((const enum interfaces_enum)thread_id);
+
+	if ((ring != NULL || mailbox != NULL) && priority != 0u) {
+		// The ring and the mailbox have a single lane
+		result = RTEMS_INVALID_NUMBER;
+	} else if (lanes != NULL) {
+		result = send_lane_request(pool, lanes, request_data,
+					   request_size, thread_id, priority,
+					   &is_queued);
+	} else if (mailbox != NULL) {
+		result = send_mailbox_request(mailbox, request_data,
+					      request_size, thread_id,
+					      &is_queued);
+	} else if (ring != NULL) {
+		result = send_ring_request(ring, request_data, request_size,
+					   thread_id, &is_queued);
+	} else if (pool != NULL) {
+		result = send_pooled_request(pool, request_data, request_size,
+					     queue_id, priority != 0u,
+					     &is_queued);
+	} else {
+		result = put_in_queue(queue_id, request_data, request_size,
+				      priority != 0u);
+		is_queued = result == RTEMS_SUCCESSFUL;
+	}
+
+	if (!is_queued) {
+		Monitor_IndicateRequestDequeued(
+			(const enum interfaces_enum)thread_id);
+	}
+
+	return result;
+}
+
 bool ThreadsCommon_SendRequest(const void *const request_data,
 			       const uint32_t request_size,
 			       const uint32_t queue_id,
 			       const uint32_t thread_id)
 {
-	const rtems_status_code result = rtems_message_queue_send(
-		(rtems_id)queue_id, request_data, request_size);
+	return ThreadsCommon_SendRequestWithPriority(
+		request_data, request_size, queue_id, thread_id, 0u);
+}
 
-	int32_t queued_items_count = Monitor_GetQueuedItemsCount(
-		(const enum interfaces_enum)thread_id);
-	if (queued_items_count > -1 &&
-	    queued_items_count > maximum_queued_items[thread_id]) {
-		maximum_queued_items[thread_id] = queued_items_count;
-	}
+bool ThreadsCommon_SendRequestWithPriority(const void *const request_data,
+					   const uint32_t request_size,
+					   const uint32_t queue_id,
+					   const uint32_t thread_id,
+					   const uint32_t priority)
+{
+	const rtems_status_code result = send_request(
+		request_data, request_size, queue_id, thread_id, priority);
 
-	if (result == RTEMS_TOO_MANY &&
-	    Monitor_MessageQueueOverflowCallback != NULL) {
-		Monitor_MessageQueueOverflowCallback(
-			(const enum interfaces_enum)thread_id, 1);
-		return true;
+	if (result == RTEMS_TOO_MANY) {
+		return Monitor_IndicateRequestsDropped(
+			(const enum interfaces_enum)thread_id, 1u);
 	}
 
 	return result == RTEMS_SUCCESSFUL;
-}
\ No newline at end of file
+}
+
+bool ThreadsCommon_SendRequestBatch(const void *const requests_data,
+				    const uint32_t request_size,
+				    const uint32_t requests_count,
+				    const uint32_t queue_id,
+				    const uint32_t thread_id)
+{
+	const uint8_t *request = (const uint8_t *)requests_data;
+	uint32_t overflowed_requests_count = 0u;
+	bool is_successful = true;
+
+	for (uint32_t i = 0u; i < requests_count; i++) {
+		const rtems_status_code result =
+			send_request(request, request_size, queue_id, thread_id,
+				     0u);
+		if (result == RTEMS_TOO_MANY) {
+			overflowed_requests_count++;
+		} else if (result != RTEMS_SUCCESSFUL) {
+			is_successful = false;
+		}
+		request += request_size;
+	}
+
+	if (overflowed_requests_count > 0u &&
+	    !Monitor_IndicateRequestsDropped(
+		    (const enum interfaces_enum)thread_id,
+		    overflowed_requests_count)) {
+		return false;
+	}
+
+	return is_successful;
+}
@@ -28,6 +28,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "Mailbox.h"
+#include "OffsetPlanner.h"
+#include "RequestPool.h"
+#include "SpscRing.h"
+
 #define EMPTY_REQUEST_DATA_BUFFER_SIZE 8
 
 /**
@@ -42,8 +47,14 @@ struct CyclicInterfaceEmptyRequestData {
 };
 
 /**
- * @brief               Creates a timer that periodically sends a request to
- *                      the indicated queue. The request is empty.
+ * @brief               Registers a cyclic request, which is periodically sent
+ *                      to the indicated queue. The request is empty. All
+ *                      cyclic requests are released by a single Hal timer,
+ *                      with nanosecond precision release times. The first
+ *                      release happens at dispatch_offset_ns + interval_ns.
+ *                      The receiving interface cannot use the request pool,
+ *                      the ring or the mailbox, nor be released by events
+ *                      or by a rate monotonic period.
  *
  * @param[in] interval_ns         cyclic interval period, expressed in
  * nanoseconds
@@ -60,10 +71,306 @@ bool ThreadsCommon_CreateCyclicRequest(const uint64_t interval_ns,
 				       const uint32_t queue_id,
 				       const uint32_t request_size);
 
+/**
+ * @brief               Registers a cyclic request released by the cyclic
+ *                      dispatcher with RT_CYCLIC_RELEASE_EVENT
+ *                      (RTEMS_EVENT_29 by default) sent to the interface
+ *                      thread, instead of an empty request sent to its
+ *                      queue. Intended for threads serving only cyclic
+ *                      interfaces, which then need no queue. The thread
+ *                      waits for releases in ThreadsCommon_WaitForCyclicEvent.
+ *                      This function is not thread safe, it is assumed to
+ *                      be used only during system initialization.
+ *
+ * @param[in] thread_id           cyclic interface
+ * @param[in] interval_ns         cyclic interval period, expressed in
+ *                                nanoseconds
+ * @param[in] dispatch_offset_ns  cyclic interval dispatch offset, expressed
+ *                                in nanoseconds, the first release happens
+ *                                at dispatch_offset_ns + interval_ns
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateCyclicEventRequest(const uint32_t thread_id,
+					    const uint64_t interval_ns,
+					    const uint64_t dispatch_offset_ns);
+
+/**
+ * @brief               Suspends the calling interface thread until its next
+ *                      release, for interfaces registered with
+ *                      ThreadsCommon_CreateCyclicEventRequest. Releases
+ *                      which happened while the thread was not waiting are
+ *                      coalesced into a single activation, timed from the
+ *                      latest release, and counted as coalesced releases in
+ *                      the Monitor timing data.
+ *
+ * @param[in] thread_id cyclic interface of the calling thread
+ *
+ * @return              Bool indicating whether the thread was released
+ */
+bool ThreadsCommon_WaitForCyclicEvent(const uint32_t thread_id);
+
+/**
+ * @brief               Registers a cyclic interface released by an RTEMS
+ *                      rate monotonic period instead of the cyclic
+ *                      dispatcher. The interface thread waits for releases
+ *                      in ThreadsCommon_WaitForCyclicRelease instead of
+ *                      receiving empty requests from its queue, which
+ *                      removes the queue hop and the copies of the request.
+ *                      Releases happen on clock ticks, so the interval is
+ *                      rounded to the nearest tick. Period statistics are
+ *                      available with Monitor_GetPeriodStatistics. Each
+ *                      interface in this mode uses one RTEMS period, see
+ *                      CONFIGURE_MAXIMUM_PERIODS. This function is not
+ *                      thread safe, it is assumed to be used only during
+ *                      system initialization.
+ *
+ * @param[in] thread_id           cyclic interface
+ * @param[in] interval_ns         cyclic interval period, expressed in
+ *                                nanoseconds, at least one clock tick
+ * @param[in] dispatch_offset_ns  cyclic interval dispatch offset, expressed
+ *                                in nanoseconds, the first release happens
+ *                                at dispatch_offset_ns + interval_ns
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateCyclicPeriod(const uint32_t thread_id,
+				      const uint64_t interval_ns,
+				      const uint64_t dispatch_offset_ns);
+
+/**
+ * @brief               Suspends the calling interface thread until its next
+ *                      release, for interfaces registered with
+ *                      ThreadsCommon_CreateCyclicPeriod. The first call
+ *                      creates the period, so it shall be made by the
+ *                      interface thread. A period overrun is detected by
+ *                      RTEMS, the thread is then released immediately. The
+ *                      release is timed by ThreadsCommon_ProcessRequest, as
+ *                      for the dispatcher.
+ *
+ * @param[in] thread_id cyclic interface of the calling thread
+ *
+ * @return              Bool indicating whether the thread was released
+ */
+bool ThreadsCommon_WaitForCyclicRelease(const uint32_t thread_id);
+
+/**
+ * @brief               Replaces dispatch offsets of all created cyclic
+ *                      requests with offsets computed by OffsetPlanner_Plan,
+ *                      spreading the releases so that as few activations as
+ *                      possible overlap. The offsets are applied from the
+ *                      time of the call, so the next release of every
+ *                      request happens at now + offset + interval. The
+ *                      function can be called after the interfaces have run
+ *                      for a while, to plan with measured execution times.
+ *                      Host tools can use OffsetPlanner directly to compute
+ *                      offsets passed to ThreadsCommon_CreateCyclicRequest.
+ *
+ * @param[in] wcets_ns        declared WCETs in nanoseconds, indexed by
+ *                            thread ID, or NULL to use the maximum measured
+ *                            execution times
+ * @param[in] granularity_ns  step between evaluated offsets
+ *
+ * @return              Bool indicating whether the offsets were applied
+ */
+bool ThreadsCommon_PlanCyclicOffsets(const uint64_t *const wcets_ns,
+				     const uint64_t granularity_ns);
+
+/**
+ * @brief               Creates a pool of request buffers for the indicated
+ *                      interface. Afterwards the queue of the interface
+ *                      carries only handles of the requests, so it shall be
+ *                      created with the message size of
+ *                      sizeof(struct RequestPool_Handle). Requests allocated
+ *                      with ThreadsCommon_AllocateRequest are passed without
+ *                      copying, other requests are copied once into the pool.
+ *                      Cyclic interfaces, which receive raw empty requests,
+ *                      cannot have a pool. This function is not thread safe,
+ *                      it is assumed to be used only during system
+ *                      initialization.
+ *
+ * @param[in] thread_id     interface receiving the requests
+ * @param[in] storage       storage of the pool, of
+ *                          REQUEST_POOL_STORAGE_SIZE(block_size, blocks_count)
+ *                          bytes, aligned to REQUEST_POOL_ALIGNMENT
+ * @param[in] block_size    maximum size of the request data
+ * @param[in] blocks_count  number of requests which can be in flight
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateRequestPool(const uint32_t thread_id,
+				     void *const storage,
+				     const uint32_t block_size,
+				     const uint32_t blocks_count);
+
+/**
+ * @brief               Switches the indicated interface to the ring
+ *                      transport. Requests are passed through a lock-free
+ *                      single-producer single-consumer ring instead of the
+ *                      message queue, so the interface shall have exactly one
+ *                      sending thread. The receiving thread waits in
+ *                      ThreadsCommon_ReceiveRequest and is woken with
+ *                      RT_TRANSPORT_EVENT (RTEMS_EVENT_30 by default)
+ *                      only when the ring becomes non-empty. An interface
+ *                      can use only one of the request pool, the ring and
+ *                      the mailbox, and an interface receiving a cyclic
+ *                      request cannot use the ring. This function is not
+ *                      thread safe, it is assumed to be used only during
+ *                      system initialization.
+ *
+ * @param[in] thread_id     interface receiving the requests
+ * @param[in] storage       storage of the ring, of
+ *                          SPSC_RING_STORAGE_SIZE(message_size, slots_count)
+ *                          bytes, aligned to SPSC_RING_ALIGNMENT
+ * @param[in] message_size  maximum size of the request data
+ * @param[in] slots_count   number of requests which can be queued
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateRingTransport(const uint32_t thread_id,
+				       void *const storage,
+				       const uint32_t message_size,
+				       const uint32_t slots_count);
+
+/**
+ * @brief               Splits requests of the indicated interface into
+ *                      priority lanes, received highest first. Each lane is
+ *                      a FIFO linking blocks of the request pool of the
+ *                      interface, so the pool shall be created first and
+ *                      it bounds the number of requests in all lanes. The
+ *                      requests are not passed through the message queue,
+ *                      the receiving thread waits in
+ *                      ThreadsCommon_ReceiveRequest and is woken with
+ *                      RT_TRANSPORT_EVENT. Occupancy of every lane is
+ *                      reported to the Monitor. This function is not thread
+ *                      safe, it is assumed to be used only during system
+ *                      initialization.
+ *
+ * @param[in] thread_id     interface receiving the requests
+ * @param[in] lanes_count   number of lanes, at most RT_MAX_REQUEST_LANES
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateRequestLanes(const uint32_t thread_id,
+				      const uint32_t lanes_count);
+
+/**
+ * @brief               Switches the indicated interface to the mailbox
+ *                      transport, intended for interfaces carrying state,
+ *                      where only the latest value matters. Requests are
+ *                      written to a triple buffer instead of the message
+ *                      queue, a request not received yet is overwritten by
+ *                      the next one, so sending never blocks or overflows.
+ *                      The interface shall have exactly one sending thread.
+ *                      The receiving thread waits in
+ *                      ThreadsCommon_ReceiveRequest and is woken with
+ *                      RT_TRANSPORT_EVENT at most once per new value. An
+ *                      interface can use only one of the request pool, the
+ *                      ring and the mailbox, and an interface receiving a
+ *                      cyclic request cannot use the mailbox. This function
+ *                      is not thread safe, it is assumed to be used only
+ *                      during system initialization.
+ *
+ * @param[in] thread_id     interface receiving the requests
+ * @param[in] storage       storage of the mailbox, of
+ *                          MAILBOX_STORAGE_SIZE(message_size) bytes, aligned
+ *                          to MAILBOX_ALIGNMENT
+ * @param[in] message_size  maximum size of the request data
+ *
+ * @return              Bool indicating whether the creation was
+ *                      successful
+ */
+bool ThreadsCommon_CreateMailboxTransport(const uint32_t thread_id,
+					  void *const storage,
+					  const uint32_t message_size);
+
+/**
+ * @brief               Waits for the oldest request of an interface using
+ *                      the ring transport, the latest request of an
+ *                      interface using the mailbox transport, or the oldest
+ *                      request of the highest non-empty lane. The request
+ *                      stays in the transport and is released by
+ *                      ThreadsCommon_ProcessRequest, so it shall be passed
+ *                      there before the next receive.
+ *
+ * @param[in] thread_id      interface receiving the request
+ * @param[out] request_data  pointer to request data
+ * @param[out] request_size  size of the request data
+ *
+ * @return              Bool indicating whether a request was received
+ */
+bool ThreadsCommon_ReceiveRequest(const uint32_t thread_id,
+				  const void **const request_data,
+				  uint32_t *const request_size);
+
+/**
+ * @brief               Allocates a request buffer from the pool of the
+ *                      indicated interface, to be filled in place and passed
+ *                      to ThreadsCommon_SendRequest. The buffer is owned by
+ *                      the caller until it is sent or freed.
+ *
+ * @param[in] thread_id interface receiving the request
+ *
+ * @return              Buffer of the block size of the pool, or NULL if the
+ *                      interface has no pool or the pool is exhausted
+ */
+void *ThreadsCommon_AllocateRequest(const uint32_t thread_id);
+
+/**
+ * @brief               Returns an allocated request buffer which is not going
+ *                      to be sent
+ *
+ * @param[in] thread_id interface owning the pool
+ * @param[in] buffer    buffer returned by ThreadsCommon_AllocateRequest
+ *
+ * @return              Bool indicating whether the buffer was freed
+ */
+bool ThreadsCommon_FreeRequest(const uint32_t thread_id, void *const buffer);
+
+/**
+ * @brief               Sets the execution budget of the indicated interface.
+ *                      A Hal timer is armed when the user function is
+ *                      invoked and cancelled when it returns. If the budget
+ *                      expires first, the overrun is reported to the Monitor
+ *                      from the interrupt context, while the activation is
+ *                      still in progress, see Monitor_IndicateBudgetOverrun.
+ *                      Optionally, the priority of the interface thread is
+ *                      then changed until the end of the activation, when
+ *                      the real priority from the start of the activation
+ *                      is restored, unless the priority was changed again
+ *                      in the meantime. Each interface with a budget uses
+ *                      one Hal timer, see RT_MAX_HAL_TIMERS. This function
+ *                      is not thread safe, it is assumed to be used only
+ *                      during system initialization.
+ *
+ * @param[in] thread_id        interface to supervise
+ * @param[in] budget_ns        execution budget in nanoseconds, 0 disables
+ *                             the supervision
+ * @param[in] overrun_priority RTEMS priority of the interface thread after
+ *                             an overrun, usually numerically greater than
+ *                             its own, RTEMS_CURRENT_PRIORITY keeps the
+ *                             priority unchanged
+ *
+ * @return              Bool indicating whether the budget was set
+ */
+bool ThreadsCommon_SetExecutionBudget(const uint32_t thread_id,
+				      const uint64_t budget_ns,
+				      const uint32_t overrun_priority);
+
 /**
  * @brief               Function is responsible for invoking the provided user
  *                      function with provided request data, and performing all
- *                      required logging and monitoring
+ *                      required logging and monitoring. If the interface has
+ *                      a request pool, the request data is a handle, and the
+ *                      buffer is returned to the pool after the user function
+ *                      returns. A handle which does not refer to a block of
+ *                      the pool is dropped without invoking the user
+ *                      function.
  *
  * @param[in] request_data   pointer to request data
  * @param[in] request_size   size of the request data
@@ -78,9 +385,45 @@ bool ThreadsCommon_ProcessRequest(const void *const request_data,
 				  void *user_function,
 				  const uint32_t thread_id);
 
+/**
+ * @brief               Drain mode variant of ThreadsCommon_ProcessRequest.
+ *                      Processes the already received request, followed by
+ *                      the requests pending in the queue, up to the given
+ *                      count, without waiting. The whole batch is logged as
+ *                      a single activation, and every request is accounted
+ *                      with the average execution time of the batch.
+ *                      Requests of a cyclic interface are additionally
+ *                      timed one by one, each against its own release.
+ *
+ * @param[in] request_buffer     buffer holding the received request, large
+ *                               enough for the maximum message size of the
+ *                               queue, reused for the following requests.
+ *                               For the ring and mailbox transports, the
+ *                               request returned by
+ *                               ThreadsCommon_ReceiveRequest.
+ * @param[in] request_size       size of the received request
+ * @param[in] queue_id           ID of the queue to drain
+ * @param[in] user_function      pointer to user function to execute
+ * @param[in] thread_id          used for performance logging
+ * @param[in] max_requests_count maximum number of requests processed,
+ *                               including the received one
+ *
+ * @return              Bool indicating whether the request processing was
+ *                      successful
+ */
+bool ThreadsCommon_ProcessRequestBatch(void *const request_buffer,
+				       const uint32_t request_size,
+				       const uint32_t queue_id,
+				       void *user_function,
+				       const uint32_t thread_id,
+				       const uint32_t max_requests_count);
+
 /**
  * @brief               Function is responsible for putting a request in specific
  * 						rtems queue. It performs also queue analysis.
+ *                      If the interface has a request pool, only a handle is
+ *                      queued and a buffer allocated from the pool is owned
+ *                      by the runtime after the call, whatever the result.
  *
  * @param[in] request_data   pointer to request data
  * @param[in] request_size   size of the request data
@@ -95,4 +438,54 @@ bool ThreadsCommon_SendRequest(const void *const request_data,
 			       const uint32_t queue_id,
 			       const uint32_t thread_id);
 
+/**
+ * @brief               Variant of ThreadsCommon_SendRequest with a priority
+ *                      of the request. For an interface with request lanes,
+ *                      the priority is the index of the lane, and lanes are
+ *                      received highest first. For an interface using the
+ *                      message queue, any non-zero priority puts the request
+ *                      at the front of the queue, so it is received before
+ *                      all requests already queued, and urgent requests are
+ *                      received in reverse order of sending. The ring and
+ *                      mailbox transports accept only priority 0.
+ *
+ * @param[in] request_data   pointer to request data
+ * @param[in] request_size   size of the request data
+ * @param[in] queue_id       the id of queue in which the request will be
+ *                           placed
+ * @param[in] thread_id      used for queue analysis
+ * @param[in] priority       priority of the request, 0 is the lowest
+ *
+ * @return              Bool indicating whether the request was sent or
+ *                      the overflow was reported
+ */
+bool ThreadsCommon_SendRequestWithPriority(const void *const request_data,
+					   const uint32_t request_size,
+					   const uint32_t queue_id,
+					   const uint32_t thread_id,
+					   const uint32_t priority);
+
+/**
+ * @brief               Puts a burst of requests of equal size in specific
+ *                      rtems queue. Queue analysis is performed once for the
+ *                      whole batch, and overflowed requests are reported
+ *                      with a single call of the overflow callback.
+ *
+ * @param[in] requests_data  pointer to requests data, placed one after
+ *                           another
+ * @param[in] request_size   size of a single request data
+ * @param[in] requests_count number of requests
+ * @param[in] queue_id       the id of queue in which the requests will be
+ *                           placed
+ * @param[in] thread_id      used for queue analysis
+ *
+ * @return              Bool indicating whether all requests were sent or
+ *                      the overflow was reported
+ */
+bool ThreadsCommon_SendRequestBatch(const void *const requests_data,
+				    const uint32_t request_size,
+				    const uint32_t requests_count,
+				    const uint32_t queue_id,
+				    const uint32_t thread_id);
+
 #endif
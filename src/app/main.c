@@ -58,7 +58,7 @@ rtems_task Init(rtems_task_argument argument)
 
 #define CONFIGURE_MAXIMUM_PARTITIONS 0
 
-#define CONFIGURE_MAXIMUM_PERIODS 0
+#define CONFIGURE_MAXIMUM_PERIODS RUNTIME_TASK_COUNT
 
 #define CONFIGURE_MAXIMUM_SEMAPHORES RUNTIME_FUNCTION_COUNT
 
@@ -67,7 +67,7 @@ rtems_task Init(rtems_task_argument argument)
 #define CONFIGURE_MINIMUM_TASKS_WITH_USER_PROVIDED_STORAGE \
 	CONFIGURE_MAXIMUM_TASKS
 
-#define CONFIGURE_MAXIMUM_TIMERS RUNTIME_TASK_COUNT
+#define CONFIGURE_MAXIMUM_TIMERS 0
 
 #define CONFIGURE_MAXIMUM_USER_EXTENSIONS 0
 
@@ -0,0 +1,281 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ChainedTimebaseTest.c
+ * @brief   Reads a simulated chain of three 16-bit Tic channels, in which
+ *          carries propagate with a delay, and checks that every accepted
+ *          read is exact and that a reader preempted on every pass falls
+ *          back to a read with interrupts disabled.
+ */
+
+#include "HostTest.h"
+
+#include <ChainedTimebase.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CHANNEL_PERIOD (1ull << 16u)
+#define MAXIMUM_READ_STEP 24u
+#define PREEMPTION_RATE 256u
+
+enum SimulatedChannel {
+	SimulatedChannel_Low,
+	SimulatedChannel_Middle,
+	SimulatedChannel_High,
+	SimulatedChannel_Epoch,
+};
+
+struct SimulatedTic {
+	uint64_t now;
+	uint64_t carry_delay;
+	uint64_t random_state;
+	uint64_t low_read_time;
+	uint32_t reads_count;
+	bool is_preempted_after_low;
+	bool are_interrupts_disabled;
+};
+
+static struct SimulatedTic *active_tic;
+
+static uint64_t delayed_count(const uint64_t now, const uint64_t delay,
+			      const uint32_t shift)
+{
+	return now >= delay ? (now - delay) >> shift : 0u;
+}
+
+// Every register access takes some time, and the reader is sometimes
+// preempted, even for more than a whole period of the lowest channel
+static void advance(struct SimulatedTic *const tic)
+{
+	const uint64_t random = host_test_random(&tic->random_state);
+	tic->now += 1u + random % MAXIMUM_READ_STEP;
+	if (!tic->are_interrupts_disabled &&
+	    (random >> 32u) % PREEMPTION_RATE == 0u) {
+		tic->now += (random >> 40u) % (3u * CHANNEL_PERIOD);
+	}
+}
+
+static uint32_t read_channel(struct SimulatedTic *const tic,
+			     const enum SimulatedChannel channel)
+{
+	advance(tic);
+	tic->reads_count++;
+
+	// Each channel is clocked by the wrap of the previous one, delayed
+	// by the carry propagation. The epoch is incremented by the overflow
+	// interrupt of the last channel.
+	switch (channel) {
+	case SimulatedChannel_Low:
+		tic->low_read_time = tic->now;
+		if (tic->is_preempted_after_low &&
+		    !tic->are_interrupts_disabled) {
+			tic->now += CHANNEL_PERIOD;
+		}
+		return (uint32_t)(tic->low_read_time &
+				  CHAINED_TIMEBASE_CHANNEL_MASK);
+	case SimulatedChannel_Middle:
+		return (uint32_t)(delayed_count(tic->now, tic->carry_delay,
+						16u) &
+				  CHAINED_TIMEBASE_CHANNEL_MASK);
+	case SimulatedChannel_High:
+		return (uint32_t)(delayed_count(tic->now,
+						2u * tic->carry_delay, 32u) &
+				  CHAINED_TIMEBASE_CHANNEL_MASK);
+	case SimulatedChannel_Epoch:
+	default:
+		return (uint32_t)delayed_count(tic->now,
+					       2u * tic->carry_delay, 48u);
+	}
+}
+
+// Same sequence of reads as read_timebase_sample in Hal.c
+static void read_sample(struct ChainedTimebase_Sample *const sample)
+{
+	struct SimulatedTic *const tic = active_tic;
+	sample->epoch = read_channel(tic, SimulatedChannel_Epoch);
+	sample->high = read_channel(tic, SimulatedChannel_High);
+	sample->middle = read_channel(tic, SimulatedChannel_Middle);
+	sample->low = read_channel(tic, SimulatedChannel_Low);
+	sample->middle_check = read_channel(tic, SimulatedChannel_Middle);
+	sample->high_check = read_channel(tic, SimulatedChannel_High);
+	sample->epoch_check = read_channel(tic, SimulatedChannel_Epoch);
+}
+
+// Same fallback as read_hardware_ticks in Hal.c, interrupts disabled
+// prevent the preemption of the reader
+static uint64_t read_timebase(struct SimulatedTic *const tic)
+{
+	active_tic = tic;
+	uint64_t ticks;
+	if (ChainedTimebase_TryRead(read_sample, &ticks)) {
+		return ticks;
+	}
+
+	tic->are_interrupts_disabled = true;
+	while (!ChainedTimebase_TryRead(read_sample, &ticks)) {
+	}
+	tic->are_interrupts_disabled = false;
+
+	return ticks;
+}
+
+static void read_around(struct SimulatedTic *const tic, const uint64_t time,
+			uint32_t *const maximum_reads_count)
+{
+	tic->now = time > 64u ? time - 64u : 0u;
+	uint64_t previous = 0u;
+	for (uint32_t i = 0u; i < 16u; i++) {
+		tic->reads_count = 0u;
+		const uint64_t ticks = read_timebase(tic);
+
+		// The accepted value is the exact time of the read of the
+		// lowest channel
+		HOST_TEST_CHECK(ticks == tic->low_read_time);
+		HOST_TEST_CHECK(ticks >= previous);
+		previous = ticks;
+
+		if (tic->reads_count > *maximum_reads_count) {
+			*maximum_reads_count = tic->reads_count;
+		}
+	}
+}
+
+static void test_carry_boundaries(const uint64_t carry_delay)
+{
+	struct SimulatedTic tic = {
+		.carry_delay = carry_delay,
+		.random_state = 0x9E3779B97F4A7C15ull + carry_delay,
+	};
+	uint32_t maximum_reads_count = 0u;
+
+	for (uint32_t shift = 16u; shift <= 48u; shift += 16u) {
+		for (uint64_t wrap = 1u; wrap < 64u; wrap++) {
+			for (uint32_t repeat = 0u; repeat < 64u; repeat++) {
+				read_around(&tic, wrap << shift,
+					    &maximum_reads_count);
+			}
+		}
+	}
+
+	printf("carry delay %llu: at most %u register reads per timestamp\n",
+	       (unsigned long long)carry_delay, maximum_reads_count);
+}
+
+static void test_long_run(void)
+{
+	struct SimulatedTic tic = {
+		.carry_delay = CHAINED_TIMEBASE_CARRY_GUARD_TICKS,
+		.random_state = 12345u,
+	};
+
+	uint64_t previous = 0u;
+	for (uint32_t i = 0u; i < 2000000u; i++) {
+		const uint64_t ticks = read_timebase(&tic);
+		HOST_TEST_CHECK(ticks == tic.low_read_time);
+		HOST_TEST_CHECK(ticks >= previous);
+		previous = ticks;
+	}
+}
+
+static void test_rejects_inconsistent_samples(void)
+{
+	const struct ChainedTimebase_Sample consistent = {
+		.epoch = 1u,
+		.high = 2u,
+		.middle = 3u,
+		.low = CHAINED_TIMEBASE_CARRY_GUARD_TICKS,
+		.middle_check = 3u,
+		.high_check = 2u,
+		.epoch_check = 1u,
+	};
+	HOST_TEST_CHECK(ChainedTimebase_IsConsistent(&consistent));
+	HOST_TEST_CHECK(ChainedTimebase_Compose(&consistent) ==
+			((1ull << 48u) | (2ull << 32u) | (3ull << 16u) |
+			 CHAINED_TIMEBASE_CARRY_GUARD_TICKS));
+
+	// The lowest channel has just wrapped, the carry may be pending
+	struct ChainedTimebase_Sample sample = consistent;
+	sample.low = CHAINED_TIMEBASE_CARRY_GUARD_TICKS - 1u;
+	HOST_TEST_CHECK(!ChainedTimebase_IsConsistent(&sample));
+
+	sample = consistent;
+	sample.middle_check = 4u;
+	HOST_TEST_CHECK(!ChainedTimebase_IsConsistent(&sample));
+
+	sample = consistent;
+	sample.high_check = 3u;
+	HOST_TEST_CHECK(!ChainedTimebase_IsConsistent(&sample));
+
+	sample = consistent;
+	sample.epoch_check = 2u;
+	HOST_TEST_CHECK(!ChainedTimebase_IsConsistent(&sample));
+}
+
+static void test_preempted_on_every_pass(void)
+{
+	const uint32_t reads_per_pass = 7u;
+	struct SimulatedTic tic = {
+		.carry_delay = CHAINED_TIMEBASE_CARRY_GUARD_TICKS,
+		.random_state = 777u,
+		.is_preempted_after_low = true,
+	};
+
+	for (uint64_t wrap = 1u; wrap < 4096u; wrap++) {
+		tic.now = (wrap << 16u) - 8u;
+
+		// The upper channels change during every pass
+		active_tic = &tic;
+		tic.reads_count = 0u;
+		uint64_t ticks = UINT64_MAX;
+		HOST_TEST_CHECK(!ChainedTimebase_TryRead(read_sample, &ticks));
+		HOST_TEST_CHECK(ticks == UINT64_MAX);
+		HOST_TEST_CHECK(tic.reads_count ==
+				CHAINED_TIMEBASE_MAXIMUM_PASSES *
+					reads_per_pass);
+
+		// The read with interrupts disabled ends after the guard band
+		tic.reads_count = 0u;
+		const uint64_t previous = tic.now;
+		ticks = read_timebase(&tic);
+		HOST_TEST_CHECK(ticks == tic.low_read_time);
+		HOST_TEST_CHECK(ticks > previous);
+		HOST_TEST_CHECK(tic.reads_count >
+				CHAINED_TIMEBASE_MAXIMUM_PASSES *
+					reads_per_pass);
+		HOST_TEST_CHECK(tic.reads_count <=
+				(CHAINED_TIMEBASE_MAXIMUM_PASSES + 2u) *
+					reads_per_pass);
+		HOST_TEST_CHECK(!tic.are_interrupts_disabled);
+	}
+}
+
+int main(void)
+{
+	test_rejects_inconsistent_samples();
+	test_preempted_on_every_pass();
+	for (uint64_t delay = 0u; delay <= CHAINED_TIMEBASE_CARRY_GUARD_TICKS;
+	     delay++) {
+		test_carry_boundaries(delay);
+	}
+	test_long_run();
+
+	return HOST_TEST_RESULT();
+}
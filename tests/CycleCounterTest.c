@@ -0,0 +1,90 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    CycleCounterTest.c
+ * @brief   Extends simulated samples of a wrapping 32-bit counter and checks
+ *          the 64-bit values across several wraps.
+ */
+
+#include "HostTest.h"
+
+#include <CycleCounter.h>
+
+#include <stdint.h>
+
+#define COUNTER_PERIOD (1ull << 32u)
+#define MAXIMUM_STEP (COUNTER_PERIOD / 1024u)
+
+static void test_extends_across_wraps(void)
+{
+	const uint64_t start = 0xFFFFF000u;
+	struct CycleCounter counter;
+	CycleCounter_Init(&counter, (uint32_t)start);
+
+	// Steps of random length, each shorter than the counter period, as
+	// long as the counter is sampled often enough
+	uint64_t random_state = 0x9E3779B97F4A7C15ull;
+	uint64_t now = start;
+	while (now < start + 5u * COUNTER_PERIOD) {
+		now += host_test_random(&random_state) % MAXIMUM_STEP;
+		HOST_TEST_CHECK(CycleCounter_Extend(&counter, (uint32_t)now) ==
+				now);
+	}
+
+	// A sample equal to the previous one is not a wrap
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, (uint32_t)now) == now);
+}
+
+static void test_extends_at_counter_maximum(void)
+{
+	struct CycleCounter counter;
+	CycleCounter_Init(&counter, 0xFFFFFFFEu);
+
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, 0xFFFFFFFFu) ==
+			0xFFFFFFFFull);
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, 0u) == COUNTER_PERIOD);
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, 0xFFFFFFFFu) ==
+			2u * COUNTER_PERIOD - 1u);
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, 0xFFFFFFFEu) ==
+			3u * COUNTER_PERIOD - 2u);
+
+	CycleCounter_Init(&counter, 0xFFFFFFFFu);
+	HOST_TEST_CHECK(CycleCounter_Extend(&counter, 0u) == COUNTER_PERIOD);
+}
+
+static void test_difference_across_wrap(void)
+{
+	HOST_TEST_CHECK(CycleCounter_Difference(10u, 25u) == 15u);
+	HOST_TEST_CHECK(CycleCounter_Difference(7u, 7u) == 0u);
+	HOST_TEST_CHECK(CycleCounter_Difference(0xFFFFFFF0u, 0x10u) == 0x20u);
+	HOST_TEST_CHECK(CycleCounter_Difference(0xFFFFFFFFu, 0u) == 1u);
+	HOST_TEST_CHECK(CycleCounter_Difference(0u, 0xFFFFFFFFu) ==
+			0xFFFFFFFFu);
+	HOST_TEST_CHECK(CycleCounter_Difference(1u, 0u) == 0xFFFFFFFFu);
+}
+
+int main(void)
+{
+	test_extends_across_wraps();
+	test_extends_at_counter_maximum();
+	test_difference_across_wrap();
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,249 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ExecutionStatisticsTest.c
+ * @brief   Checks the integer execution time statistics against the double
+ *          incremental mean they replaced, against a Welford reference of
+ *          the variance and against exact 128-bit sums, over long runs.
+ */
+
+#include "HostTest.h"
+
+#include <ExecutionStatistics.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LONG_RUN_SAMPLES_COUNT 5000000u
+#define MAXIMUM_RELATIVE_VARIANCE_ERROR 1e-9
+
+__extension__ typedef unsigned __int128 uint128;
+
+// Mean as updated on every activation before the integer statistics
+struct DoubleMean {
+	double mean;
+	uint32_t count;
+};
+
+static void add_to_double_mean(struct DoubleMean *const reference,
+			       const uint64_t sample)
+{
+	reference->mean = reference->mean + ((double)sample - reference->mean) /
+						    ((double)reference->count + 1);
+	reference->count++;
+}
+
+struct Welford {
+	double mean;
+	double squared_deviations;
+	uint32_t count;
+};
+
+static void add_to_welford(struct Welford *const reference,
+			   const uint64_t sample)
+{
+	reference->count++;
+	const double delta = (double)sample - reference->mean;
+	reference->mean += delta / (double)reference->count;
+	reference->squared_deviations +=
+		delta * ((double)sample - reference->mean);
+}
+
+struct ExactSums {
+	uint128 sum;
+	uint128 sum_of_squares;
+	uint32_t count;
+	uint64_t minimum;
+	uint64_t maximum;
+};
+
+static void add_to_exact_sums(struct ExactSums *const reference,
+			      const uint64_t sample)
+{
+	if (reference->count == 0u || sample < reference->minimum) {
+		reference->minimum = sample;
+	}
+	if (reference->count == 0u || sample > reference->maximum) {
+		reference->maximum = sample;
+	}
+	reference->sum += sample;
+	reference->sum_of_squares += (uint128)sample * sample;
+	reference->count++;
+}
+
+struct RunResult {
+	double maximum_mean_deviation_from_double;
+	double variance_relative_error;
+};
+
+// The variance is rounded down to an integer, so it is compared with the
+// reference within one unit plus the relative error
+static bool is_variance_close(const uint64_t variance, const double reference)
+{
+	return fabs((double)variance - reference) <=
+	       1.0 + reference * MAXIMUM_RELATIVE_VARIANCE_ERROR;
+}
+
+// Samples are base + uniform jitter, with occasional outliers
+static struct RunResult run(const uint64_t base, const uint64_t jitter,
+			    const uint64_t outlier, const uint32_t count,
+			    uint64_t seed)
+{
+	struct ExecutionStatistics statistics;
+	ExecutionStatistics_Init(&statistics);
+	struct DoubleMean double_mean = { 0.0, 0u };
+	struct Welford welford = { 0.0, 0.0, 0u };
+	struct ExactSums exact = { 0u, 0u, 0u, 0u, 0u };
+	struct RunResult result = { 0.0, 0.0 };
+
+	for (uint32_t i = 0u; i < count; i++) {
+		const uint64_t random = host_test_random(&seed);
+		uint64_t sample = base + (jitter != 0u ? random % jitter : 0u);
+		if (outlier != 0u && random % 1000u == 0u) {
+			sample += outlier;
+		}
+
+		ExecutionStatistics_Add(&statistics, sample);
+		add_to_double_mean(&double_mean, sample);
+		add_to_welford(&welford, sample);
+		add_to_exact_sums(&exact, sample);
+
+		// The mean is read periodically, as by Monitor_GetUsageData
+		if (i % 4096u == 0u || i + 1u == count) {
+			struct ExecutionStatistics_Summary summary;
+			ExecutionStatistics_Compute(&statistics, &summary);
+			HOST_TEST_CHECK(summary.mean ==
+					(uint64_t)(exact.sum / exact.count));
+			const double deviation = fabs(
+				(double)summary.mean - floor(double_mean.mean));
+			if (deviation >
+			    result.maximum_mean_deviation_from_double) {
+				result.maximum_mean_deviation_from_double =
+					deviation;
+			}
+		}
+	}
+
+	struct ExecutionStatistics_Summary summary;
+	ExecutionStatistics_Compute(&statistics, &summary);
+	HOST_TEST_CHECK(summary.samples_count == count);
+	HOST_TEST_CHECK(summary.minimum == exact.minimum);
+	HOST_TEST_CHECK(summary.maximum == exact.maximum);
+
+	const double welford_variance =
+		welford.squared_deviations / (double)welford.count;
+	HOST_TEST_CHECK(is_variance_close(summary.variance, welford_variance));
+	if (welford_variance > 0.0) {
+		result.variance_relative_error =
+			fabs((double)summary.variance - welford_variance) /
+			welford_variance;
+	}
+
+	// n^2 * variance = n * sum of squares - sum^2, exact when it fits
+	const uint128 n = exact.count;
+	if (exact.sum_of_squares <= ~(uint128)0 / n) {
+		const uint128 scaled_variance =
+			n * exact.sum_of_squares - exact.sum * exact.sum;
+		const double exact_variance =
+			(double)scaled_variance / ((double)n * (double)n);
+		HOST_TEST_CHECK(
+			is_variance_close(summary.variance, exact_variance));
+	}
+
+	return result;
+}
+
+static void test_long_runs(void)
+{
+	// Base execution time, jitter and outlier, in nanoseconds
+	static const uint64_t runs[][3] = {
+		{ 1000u, 100u, 0u },
+		{ 250000u, 20000u, 5000000u },
+		{ 3000000000u, 1000000u, 0u },
+		{ 7000000000u, 1u, 0u },
+		{ 0u, 1000000000u, 50000000000u },
+		{ 50000000000u, 3000000000u, 0u },
+	};
+
+	for (uint32_t i = 0u; i < sizeof(runs) / sizeof(runs[0]); i++) {
+		const struct RunResult result =
+			run(runs[i][0], runs[i][1], runs[i][2],
+			    LONG_RUN_SAMPLES_COUNT, i + 1u);
+
+		// The double mean accumulates rounding errors, it may differ
+		// from the exact one by a fraction of a nanosecond
+		HOST_TEST_CHECK(result.maximum_mean_deviation_from_double <=
+				1.0);
+		printf("base %llu ns: mean deviation from double %.0f ns, "
+		       "variance relative error %.3g\n",
+		       (unsigned long long)runs[i][0],
+		       result.maximum_mean_deviation_from_double,
+		       result.variance_relative_error);
+	}
+}
+
+static void test_small_cases(void)
+{
+	struct ExecutionStatistics statistics;
+	struct ExecutionStatistics_Summary summary;
+	ExecutionStatistics_Init(&statistics);
+
+	ExecutionStatistics_Compute(&statistics, &summary);
+	HOST_TEST_CHECK(summary.samples_count == 0u);
+	HOST_TEST_CHECK(summary.mean == 0u);
+	HOST_TEST_CHECK(summary.variance == 0u);
+
+	// Samples below the first one, which is the shift
+	ExecutionStatistics_Add(&statistics, 10u);
+	ExecutionStatistics_Add(&statistics, 4u);
+	ExecutionStatistics_Add(&statistics, 1u);
+	ExecutionStatistics_Compute(&statistics, &summary);
+	HOST_TEST_CHECK(summary.samples_count == 3u);
+	HOST_TEST_CHECK(summary.minimum == 1u);
+	HOST_TEST_CHECK(summary.maximum == 10u);
+	HOST_TEST_CHECK(summary.mean == 5u);
+	HOST_TEST_CHECK(summary.variance == 14u);
+
+	// Mean rounded down, not toward the shift
+	ExecutionStatistics_Init(&statistics);
+	ExecutionStatistics_Add(&statistics, 2u);
+	ExecutionStatistics_Add(&statistics, 1u);
+	ExecutionStatistics_Compute(&statistics, &summary);
+	HOST_TEST_CHECK(summary.mean == 1u);
+
+	// Squares carry into the upper half of the 128-bit sum
+	ExecutionStatistics_Init(&statistics);
+	ExecutionStatistics_Add(&statistics, 0u);
+	ExecutionStatistics_Add(&statistics, 1ull << 32u);
+	ExecutionStatistics_Add(&statistics, 1ull << 32u);
+	ExecutionStatistics_Add(&statistics, 0u);
+	ExecutionStatistics_Compute(&statistics, &summary);
+	HOST_TEST_CHECK(summary.mean == 1ull << 31u);
+	HOST_TEST_CHECK(summary.variance == 1ull << 62u);
+}
+
+int main(void)
+{
+	test_small_cases();
+	test_long_runs();
+
+	return HOST_TEST_RESULT();
+}
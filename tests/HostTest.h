@@ -0,0 +1,71 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOSTTEST_H
+#define HOSTTEST_H
+
+/**
+ * @file    HostTest.h
+ * @brief   Minimal checks shared by the host tests of the runtime modules.
+ *
+ * Each test is a standalone executable returning 0 on success. A failed
+ * check is reported with its location and the test continues, so that all
+ * failures of a run are visible.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static int host_test_failures_count = 0;
+
+#define HOST_TEST_CHECK(condition)                                          \
+	do {                                                                \
+		if (!(condition)) {                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n",        \
+				__FILE__, __LINE__, #condition);            \
+			host_test_failures_count++;                         \
+		}                                                           \
+	} while (0)
+
+#define HOST_TEST_RESULT() (host_test_failures_count == 0 ? 0 : 1)
+
+/**
+ * @brief   Returns monotonic time of the host in nanoseconds, for benchmarks
+ */
+static inline uint64_t host_test_now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief   Returns the next value of a deterministic pseudo-random sequence
+ */
+static inline uint64_t host_test_random(uint64_t *const state)
+{
+	// xorshift64*
+	*state ^= *state >> 12u;
+	*state ^= *state << 25u;
+	*state ^= *state >> 27u;
+	return *state * 0x2545F4914F6CDD1Dull;
+}
+
+#endif
@@ -0,0 +1,159 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    IdleAccountingTest.c
+ * @brief   Drives the idle accounting with a simulated clock and checks the
+ *          snapshots read in and out of idle periods, both by the writer
+ *          and by a concurrent reader.
+ */
+
+#include "HostTest.h"
+
+#include <IdleAccounting.h>
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WRITER_PERIODS_COUNT 20000000u
+#define READERS_COUNT 3u
+
+static struct IdleAccounting accounting;
+
+static void check_snapshot(const uint64_t expected_idle_time,
+			   const uint32_t expected_periods_count)
+{
+	uint64_t total_idle_time;
+	uint32_t idle_periods_count;
+	IdleAccounting_Read(&accounting, &total_idle_time,
+			    &idle_periods_count);
+	HOST_TEST_CHECK(total_idle_time == expected_idle_time);
+	HOST_TEST_CHECK(idle_periods_count == expected_periods_count);
+}
+
+static void test_accumulates_idle_periods(void)
+{
+	IdleAccounting_Init(&accounting);
+	check_snapshot(0u, 0u);
+
+	uint64_t random_state = 3u;
+	uint64_t now = 1000u;
+	uint64_t expected_idle_time = 0u;
+	for (uint32_t i = 1u; i <= 1000u; i++) {
+		// Busy time between the idle periods is not accounted
+		now += host_test_random(&random_state) % 5000u;
+		IdleAccounting_Enter(&accounting, now);
+
+		// The period in progress is accounted only once it ends
+		const uint64_t idle_time =
+			host_test_random(&random_state) % 100000u;
+		now += idle_time / 2u;
+		check_snapshot(expected_idle_time, i - 1u);
+
+		now += idle_time - idle_time / 2u;
+		IdleAccounting_Exit(&accounting, now);
+		expected_idle_time += idle_time;
+		check_snapshot(expected_idle_time, i);
+	}
+
+	// A clock read before the entry gives an empty period
+	IdleAccounting_Enter(&accounting, now);
+	IdleAccounting_Exit(&accounting, now - 1u);
+	check_snapshot(expected_idle_time, 1001u);
+}
+
+// Shared state used by test_concurrent_reads
+static bool is_writer_done;
+static uint32_t concurrent_failures;
+
+// The idle period number n lasts n ticks, so a consistent snapshot of n
+// periods holds n * (n + 1) / 2 ticks
+static void *run_writer(void *arg)
+{
+	(void)arg;
+	uint64_t now = 0u;
+	for (uint32_t i = 1u; i <= WRITER_PERIODS_COUNT; i++) {
+		now += 7u;
+		IdleAccounting_Enter(&accounting, now);
+		now += i;
+		IdleAccounting_Exit(&accounting, now);
+	}
+	__atomic_store_n(&is_writer_done, true, __ATOMIC_RELEASE);
+	return NULL;
+}
+
+static void *run_reader(void *arg)
+{
+	uint64_t *const reads_count = (uint64_t *)arg;
+	uint32_t previous_periods_count = 0u;
+	while (!__atomic_load_n(&is_writer_done, __ATOMIC_ACQUIRE)) {
+		uint64_t total_idle_time;
+		uint32_t idle_periods_count;
+		IdleAccounting_Read(&accounting, &total_idle_time,
+				    &idle_periods_count);
+		const uint64_t count = idle_periods_count;
+		if (total_idle_time != count * (count + 1u) / 2u ||
+		    idle_periods_count < previous_periods_count) {
+			__atomic_fetch_add(&concurrent_failures, 1u,
+					   __ATOMIC_RELAXED);
+		}
+		previous_periods_count = idle_periods_count;
+		(*reads_count)++;
+	}
+	return NULL;
+}
+
+static void test_concurrent_reads(void)
+{
+	IdleAccounting_Init(&accounting);
+	is_writer_done = false;
+	concurrent_failures = 0u;
+
+	pthread_t writer;
+	pthread_t readers[READERS_COUNT];
+	uint64_t reads_counts[READERS_COUNT] = { 0u };
+	for (uint32_t i = 0u; i < READERS_COUNT; i++) {
+		HOST_TEST_CHECK(pthread_create(&readers[i], NULL, run_reader,
+					       &reads_counts[i]) == 0);
+	}
+	HOST_TEST_CHECK(pthread_create(&writer, NULL, run_writer, NULL) == 0);
+	HOST_TEST_CHECK(pthread_join(writer, NULL) == 0);
+
+	uint64_t reads_count = 0u;
+	for (uint32_t i = 0u; i < READERS_COUNT; i++) {
+		HOST_TEST_CHECK(pthread_join(readers[i], NULL) == 0);
+		reads_count += reads_counts[i];
+	}
+
+	check_snapshot((uint64_t)WRITER_PERIODS_COUNT *
+			       (WRITER_PERIODS_COUNT + 1ull) / 2u,
+		       WRITER_PERIODS_COUNT);
+	HOST_TEST_CHECK(concurrent_failures == 0u);
+	printf("Concurrent reads: %u failures, %llu reads\n",
+	       concurrent_failures, (unsigned long long)reads_count);
+}
+
+int main(void)
+{
+	test_accumulates_idle_periods();
+	test_concurrent_reads();
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,161 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    MutexStateBenchmark.c
+ * @brief   Measures the cost of an uncontended obtain/release pair of the
+ *          Hal mutex lock word, and checks mutual exclusion under
+ *          contention with threads suspended on a semaphore, as in Hal.
+ */
+
+#include "HostTest.h"
+
+#include <MutexState.h>
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define UNCONTENDED_ITERATIONS 10000000u
+#define CONTENDING_THREADS_COUNT 4u
+#define CONTENDED_ITERATIONS 200000u
+
+struct ContendedMutex {
+	struct MutexState state;
+	sem_t waiters;
+	uint64_t protected_counter;
+};
+
+// Same protocol as Hal_MutexObtain and Hal_MutexRelease
+static void obtain(struct ContendedMutex *const mutex)
+{
+	if (MutexState_TryLock(&mutex->state)) {
+		return;
+	}
+	while (!MutexState_LockContended(&mutex->state)) {
+		sem_wait(&mutex->waiters);
+	}
+}
+
+static void release(struct ContendedMutex *const mutex)
+{
+	if (MutexState_Unlock(&mutex->state)) {
+		sem_post(&mutex->waiters);
+	}
+}
+
+static void *contend(void *arg)
+{
+	struct ContendedMutex *const mutex = (struct ContendedMutex *)arg;
+	for (uint32_t i = 0u; i < CONTENDED_ITERATIONS; i++) {
+		obtain(mutex);
+		// Non-atomic read-modify-write, lost updates reveal a broken
+		// mutual exclusion
+		const uint64_t value = mutex->protected_counter;
+		__atomic_signal_fence(__ATOMIC_SEQ_CST);
+		mutex->protected_counter = value + 1u;
+		release(mutex);
+	}
+	return NULL;
+}
+
+static void test_contended_mutual_exclusion(void)
+{
+	struct ContendedMutex mutex;
+	MutexState_Init(&mutex.state);
+	sem_init(&mutex.waiters, 0, 0u);
+	mutex.protected_counter = 0u;
+
+	pthread_t threads[CONTENDING_THREADS_COUNT];
+	for (uint32_t i = 0u; i < CONTENDING_THREADS_COUNT; i++) {
+		HOST_TEST_CHECK(pthread_create(&threads[i], NULL, contend,
+					       &mutex) == 0);
+	}
+	for (uint32_t i = 0u; i < CONTENDING_THREADS_COUNT; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	HOST_TEST_CHECK(mutex.protected_counter ==
+			(uint64_t)CONTENDING_THREADS_COUNT *
+				CONTENDED_ITERATIONS);
+	sem_destroy(&mutex.waiters);
+}
+
+static void test_states(void)
+{
+	struct MutexState state;
+	MutexState_Init(&state);
+
+	HOST_TEST_CHECK(MutexState_TryLock(&state));
+	HOST_TEST_CHECK(!MutexState_TryLock(&state));
+	HOST_TEST_CHECK(!MutexState_Unlock(&state));
+
+	HOST_TEST_CHECK(MutexState_TryLock(&state));
+	HOST_TEST_CHECK(!MutexState_LockContended(&state));
+	HOST_TEST_CHECK(MutexState_Unlock(&state));
+
+	// A waiter which locks after a wakeup keeps the contended mark
+	HOST_TEST_CHECK(MutexState_LockContended(&state));
+	HOST_TEST_CHECK(!MutexState_TryLock(&state));
+	HOST_TEST_CHECK(MutexState_Unlock(&state));
+	HOST_TEST_CHECK(MutexState_TryLock(&state));
+	HOST_TEST_CHECK(!MutexState_Unlock(&state));
+}
+
+static void benchmark_uncontended(void)
+{
+	struct MutexState state;
+	MutexState_Init(&state);
+
+	uint32_t failures_count = 0u;
+	uint64_t start = host_test_now_ns();
+	for (uint32_t i = 0u; i < UNCONTENDED_ITERATIONS; i++) {
+		failures_count += MutexState_TryLock(&state) ? 0u : 1u;
+		failures_count += MutexState_Unlock(&state) ? 1u : 0u;
+	}
+	const uint64_t lock_word_ns = host_test_now_ns() - start;
+	HOST_TEST_CHECK(failures_count == 0u);
+
+	// Reference: a mutex of the host operating system, whose
+	// uncontended path is also lock-free
+	pthread_mutex_t reference;
+	pthread_mutex_init(&reference, NULL);
+	start = host_test_now_ns();
+	for (uint32_t i = 0u; i < UNCONTENDED_ITERATIONS; i++) {
+		pthread_mutex_lock(&reference);
+		pthread_mutex_unlock(&reference);
+	}
+	const uint64_t reference_ns = host_test_now_ns() - start;
+	pthread_mutex_destroy(&reference);
+
+	printf("uncontended obtain/release: lock word %.2f ns, "
+	       "pthread mutex %.2f ns\n",
+	       (double)lock_word_ns / UNCONTENDED_ITERATIONS,
+	       (double)reference_ns / UNCONTENDED_ITERATIONS);
+}
+
+int main(void)
+{
+	test_states();
+	test_contended_mutual_exclusion();
+	benchmark_uncontended();
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,141 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    OffsetPlannerTest.c
+ * @brief   Plans offsets of sets of cyclic interfaces and checks the
+ *          overlaps of the resulting activations.
+ */
+
+#include "HostTest.h"
+
+#include <OffsetPlanner.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MILLISECOND_NS 1000000ull
+#define SECOND_NS 1000000000ull
+
+static void test_rejects_invalid_input(void)
+{
+	struct OffsetPlanner_Interface interfaces[2] = {
+		{ .period_ns = 10u * MILLISECOND_NS },
+		{ .period_ns = 0u },
+	};
+	HOST_TEST_CHECK(!OffsetPlanner_Plan(interfaces, 2u, MILLISECOND_NS));
+	HOST_TEST_CHECK(!OffsetPlanner_Plan(interfaces, 1u, 0u));
+	HOST_TEST_CHECK(!OffsetPlanner_Plan(NULL, 1u, MILLISECOND_NS));
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, 1u, MILLISECOND_NS));
+}
+
+static void test_separates_harmonic_periods(void)
+{
+	struct OffsetPlanner_Interface interfaces[] = {
+		{ .period_ns = 100u * MILLISECOND_NS,
+		  .wcet_ns = 3u * MILLISECOND_NS },
+		{ .period_ns = 10u * MILLISECOND_NS,
+		  .wcet_ns = 2u * MILLISECOND_NS },
+		{ .period_ns = 20u * MILLISECOND_NS,
+		  .wcet_ns = 2u * MILLISECOND_NS },
+		{ .period_ns = 40u * MILLISECOND_NS,
+		  .wcet_ns = 1u * MILLISECOND_NS },
+		{ .period_ns = 20u * MILLISECOND_NS,
+		  .wcet_ns = 1u * MILLISECOND_NS },
+	};
+	const uint32_t count = sizeof(interfaces) / sizeof(interfaces[0]);
+
+	HOST_TEST_CHECK(OffsetPlanner_CountOverlaps(interfaces, count) ==
+			count * (count - 1u) / 2u);
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, count, MILLISECOND_NS));
+	HOST_TEST_CHECK(OffsetPlanner_CountOverlaps(interfaces, count) == 0u);
+	for (uint32_t i = 0u; i < count; i++) {
+		HOST_TEST_CHECK(interfaces[i].offset_ns <
+				interfaces[i].period_ns);
+		HOST_TEST_CHECK(interfaces[i].offset_ns % MILLISECOND_NS == 0u);
+	}
+}
+
+static void test_limits_candidates(void)
+{
+	// Without the limit the second release would be placed exactly in the
+	// middle of the period, one candidate per nanosecond
+	struct OffsetPlanner_Interface interfaces[2] = {
+		{ .period_ns = SECOND_NS },
+		{ .period_ns = SECOND_NS },
+	};
+	const uint64_t step = (SECOND_NS + RT_OFFSET_PLANNER_MAX_CANDIDATES -
+			       1u) /
+			      RT_OFFSET_PLANNER_MAX_CANDIDATES;
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, 2u, 1u));
+	HOST_TEST_CHECK(interfaces[0].offset_ns == 0u);
+	HOST_TEST_CHECK(interfaces[1].offset_ns % step == 0u);
+	HOST_TEST_CHECK(interfaces[1].offset_ns != SECOND_NS / 2u);
+	HOST_TEST_CHECK(interfaces[1].offset_ns + step > SECOND_NS / 2u);
+	HOST_TEST_CHECK(interfaces[1].offset_ns < SECOND_NS / 2u + step);
+
+	// The increased step stays a multiple of the granularity
+	const uint64_t granularity_ns = 1000u;
+	const uint64_t multiples_count = SECOND_NS / granularity_ns;
+	const uint64_t granular_step =
+		granularity_ns *
+		((multiples_count + RT_OFFSET_PLANNER_MAX_CANDIDATES - 1u) /
+		 RT_OFFSET_PLANNER_MAX_CANDIDATES);
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, 2u, granularity_ns));
+	HOST_TEST_CHECK(interfaces[1].offset_ns % granular_step == 0u);
+	HOST_TEST_CHECK(interfaces[1].offset_ns != SECOND_NS / 2u);
+
+	// Within the limit every multiple of the granularity is a candidate
+	HOST_TEST_CHECK(SECOND_NS / MILLISECOND_NS <=
+			RT_OFFSET_PLANNER_MAX_CANDIDATES);
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, 2u, MILLISECOND_NS));
+	HOST_TEST_CHECK(interfaces[1].offset_ns == SECOND_NS / 2u);
+}
+
+static void test_reduces_inseparable_overlaps(void)
+{
+	// The activations take 120% of the period, they cannot be separated
+	struct OffsetPlanner_Interface interfaces[3];
+	for (uint32_t i = 0u; i < 3u; i++) {
+		interfaces[i] = (struct OffsetPlanner_Interface){
+			.period_ns = 10u * MILLISECOND_NS,
+			.wcet_ns = 4u * MILLISECOND_NS,
+			.offset_ns = 0u,
+		};
+	}
+	const uint32_t zero_offsets_overlaps =
+		OffsetPlanner_CountOverlaps(interfaces, 3u);
+	HOST_TEST_CHECK(zero_offsets_overlaps == 3u);
+
+	HOST_TEST_CHECK(OffsetPlanner_Plan(interfaces, 3u, MILLISECOND_NS));
+	const uint32_t planned_overlaps =
+		OffsetPlanner_CountOverlaps(interfaces, 3u);
+	HOST_TEST_CHECK(planned_overlaps > 0u);
+	HOST_TEST_CHECK(planned_overlaps < zero_offsets_overlaps);
+}
+
+int main(void)
+{
+	test_rejects_invalid_input();
+	test_separates_harmonic_periods();
+	test_limits_candidates();
+	test_reduces_inseparable_overlaps();
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,251 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    RequestPoolBenchmark.c
+ * @brief   Compares the cost of passing a request by value through a
+ *          message queue with passing a handle of a pool block, for
+ *          payloads from 64 B to 8 KB.
+ *
+ * The message queue is modelled as a FIFO of buffers of the maximum message
+ * size, the request is copied in on send and out on receive, as by
+ * rtems_message_queue_send and rtems_message_queue_receive. Only the
+ * transport is measured, the sender writes the first and the last word of
+ * the request and the receiver checks them. The ownership of rejected
+ * requests is checked with the free blocks count of the pool.
+ */
+
+#include "HostTest.h"
+
+#include <RequestPool.h>
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MINIMUM_PAYLOAD_SIZE 64u
+#define MAXIMUM_PAYLOAD_SIZE 8192u
+#define QUEUE_DEPTH 8u
+#define ITERATIONS_COUNT 200000u
+
+struct MessageQueue {
+	uint8_t messages[QUEUE_DEPTH][MAXIMUM_PAYLOAD_SIZE];
+	uint32_t sizes[QUEUE_DEPTH];
+	uint32_t head;
+	uint32_t tail;
+};
+
+static struct MessageQueue queue;
+static alignas(REQUEST_POOL_ALIGNMENT) uint8_t
+	pool_storage[REQUEST_POOL_STORAGE_SIZE(MAXIMUM_PAYLOAD_SIZE,
+					       QUEUE_DEPTH)];
+static alignas(8) uint8_t sender_buffer[MAXIMUM_PAYLOAD_SIZE];
+static alignas(8) uint8_t receiver_buffer[MAXIMUM_PAYLOAD_SIZE];
+
+static void queue_send(const void *const data, const uint32_t size)
+{
+	const uint32_t slot = queue.tail % QUEUE_DEPTH;
+	memcpy(queue.messages[slot], data, size);
+	queue.sizes[slot] = size;
+	queue.tail++;
+}
+
+static uint32_t queue_receive(void *const data)
+{
+	const uint32_t slot = queue.head % QUEUE_DEPTH;
+	const uint32_t size = queue.sizes[slot];
+	memcpy(data, queue.messages[slot], size);
+	queue.head++;
+	return size;
+}
+
+static void fill(uint8_t *const request, const uint32_t size,
+		 const uint32_t sequence)
+{
+	memcpy(request, &sequence, sizeof(sequence));
+	memcpy(request + size - sizeof(sequence), &sequence, sizeof(sequence));
+}
+
+static bool is_filled(const uint8_t *const request, const uint32_t size,
+		      const uint32_t sequence)
+{
+	uint32_t first;
+	uint32_t last;
+	memcpy(&first, request, sizeof(first));
+	memcpy(&last, request + size - sizeof(last), sizeof(last));
+	return first == sequence && last == sequence;
+}
+
+// Interface without a pool: the request is copied into the queue and out
+static uint64_t run_by_value(const uint32_t size, uint32_t *const failures)
+{
+	const uint64_t start = host_test_now_ns();
+	for (uint32_t i = 0u; i < ITERATIONS_COUNT; i++) {
+		fill(sender_buffer, size, i);
+		queue_send(sender_buffer, size);
+		const uint32_t received_size = queue_receive(receiver_buffer);
+		const bool is_valid = received_size == size &&
+				      is_filled(receiver_buffer, size, i);
+		*failures += is_valid ? 0u : 1u;
+	}
+	return host_test_now_ns() - start;
+}
+
+// Interface with a pool: the sender fills the block in place when it
+// allocated it, otherwise the request is copied once into a block
+static uint64_t run_pooled(struct RequestPool *const pool, const uint32_t size,
+			   const bool is_filled_in_place,
+			   uint32_t *const failures)
+{
+	const uint64_t start = host_test_now_ns();
+	for (uint32_t i = 0u; i < ITERATIONS_COUNT; i++) {
+		uint8_t *const buffer = (uint8_t *)RequestPool_Allocate(pool);
+		if (is_filled_in_place) {
+			fill(buffer, size, i);
+		} else {
+			fill(sender_buffer, size, i);
+			memcpy(buffer, sender_buffer, size);
+		}
+		RequestPool_MarkQueued(pool, buffer);
+		const struct RequestPool_Handle sent_handle = {
+			.buffer = buffer,
+			.size = size,
+		};
+		queue_send(&sent_handle, sizeof(sent_handle));
+
+		struct RequestPool_Handle handle;
+		const uint32_t received_size = queue_receive(&handle);
+		const bool is_valid =
+			received_size == sizeof(handle) &&
+			RequestPool_Contains(pool, handle.buffer) &&
+			handle.size == size &&
+			is_filled((const uint8_t *)handle.buffer, size, i);
+		*failures += is_valid ? 0u : 1u;
+		RequestPool_Free(pool, handle.buffer);
+	}
+	return host_test_now_ns() - start;
+}
+
+// Same checks as send_lane_request in ThreadsCommon.c, the lane is checked
+// before the request is taken
+static bool send_to_lane(struct RequestPool *const pool,
+			 struct RequestPool_Queue *const lanes,
+			 const uint32_t lanes_count, const uint32_t lane,
+			 const void *const request_data,
+			 const uint32_t request_size)
+{
+	if (lane >= lanes_count) {
+		RequestPool_Discard(pool, request_data);
+		return false;
+	}
+
+	void *const buffer = RequestPool_Take(pool, request_data, request_size);
+	if (buffer == NULL) {
+		return false;
+	}
+
+	bool is_first;
+	RequestPool_Enqueue(pool, &lanes[lane], buffer, request_size,
+			    &is_first);
+	return true;
+}
+
+static void test_rejected_requests_return_blocks(void)
+{
+	struct RequestPool pool;
+	struct RequestPool_Queue lanes[2];
+	HOST_TEST_CHECK(RequestPool_Init(&pool, pool_storage, 256u,
+					 QUEUE_DEPTH));
+	RequestPool_QueueInit(&lanes[0]);
+	RequestPool_QueueInit(&lanes[1]);
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == QUEUE_DEPTH);
+
+	// Filled in place, too big for a block
+	void *buffer = RequestPool_Allocate(&pool);
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) ==
+			QUEUE_DEPTH - 1u);
+	HOST_TEST_CHECK(!send_to_lane(&pool, lanes, 2u, 0u, buffer, 257u));
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == QUEUE_DEPTH);
+
+	// Filled in place, sent to a lane which does not exist
+	buffer = RequestPool_Allocate(&pool);
+	HOST_TEST_CHECK(!send_to_lane(&pool, lanes, 2u, 2u, buffer, 16u));
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == QUEUE_DEPTH);
+
+	// Copied requests are never taken by the pool when rejected
+	HOST_TEST_CHECK(!send_to_lane(&pool, lanes, 2u, 0u, sender_buffer,
+				      257u));
+	HOST_TEST_CHECK(!send_to_lane(&pool, lanes, 2u, 5u, sender_buffer,
+				      16u));
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == QUEUE_DEPTH);
+
+	// Accepted requests stay queued until the receiver frees them
+	buffer = RequestPool_Allocate(&pool);
+	HOST_TEST_CHECK(send_to_lane(&pool, lanes, 2u, 1u, buffer, 16u));
+	HOST_TEST_CHECK(send_to_lane(&pool, lanes, 2u, 0u, sender_buffer,
+				     16u));
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) ==
+			QUEUE_DEPTH - 2u);
+	for (uint32_t lane = 0u; lane < 2u; lane++) {
+		void *received;
+		uint32_t size;
+		HOST_TEST_CHECK(RequestPool_Dequeue(&lanes[lane], &received,
+						    &size));
+		HOST_TEST_CHECK(size == 16u);
+		RequestPool_Free(&pool, received);
+	}
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == QUEUE_DEPTH);
+}
+
+int main(void)
+{
+	test_rejected_requests_return_blocks();
+
+	struct RequestPool pool;
+	HOST_TEST_CHECK(RequestPool_Init(&pool, pool_storage,
+					 MAXIMUM_PAYLOAD_SIZE, QUEUE_DEPTH));
+
+	printf("payload   by value   copied into pool   zero-copy  [ns]\n");
+	for (uint32_t size = MINIMUM_PAYLOAD_SIZE; size <= MAXIMUM_PAYLOAD_SIZE;
+	     size *= 2u) {
+		uint32_t failures = 0u;
+		const uint64_t by_value_ns = run_by_value(size, &failures);
+		const uint64_t copied_ns =
+			run_pooled(&pool, size, false, &failures);
+		const uint64_t zero_copy_ns =
+			run_pooled(&pool, size, true, &failures);
+		HOST_TEST_CHECK(failures == 0u);
+
+		printf("%7u %10.1f %18.1f %11.1f\n", size,
+		       (double)by_value_ns / ITERATIONS_COUNT,
+		       (double)copied_ns / ITERATIONS_COUNT,
+		       (double)zero_copy_ns / ITERATIONS_COUNT);
+	}
+
+	// All blocks are back in the pool
+	void *blocks[QUEUE_DEPTH];
+	for (uint32_t i = 0u; i < QUEUE_DEPTH; i++) {
+		blocks[i] = RequestPool_Allocate(&pool);
+		HOST_TEST_CHECK(blocks[i] != NULL);
+	}
+	HOST_TEST_CHECK(RequestPool_Allocate(&pool) == NULL);
+	HOST_TEST_CHECK(RequestPool_GetFreeBlocksCount(&pool) == 0u);
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,182 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    SpscRingBenchmark.c
+ * @brief   Measures the throughput of the single-producer single-consumer
+ *          ring between two threads and the round trip latency through a
+ *          pair of rings, checking that messages arrive intact and in
+ *          order.
+ *
+ * A thread finding the ring full or empty yields, so the benchmark also
+ * completes on a single core, where it measures the cost of the handoff
+ * including the context switches.
+ */
+
+#include "HostTest.h"
+
+#include <SpscRing.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MESSAGE_SIZE 64u
+#define SLOTS_COUNT 64u
+#define THROUGHPUT_MESSAGES_COUNT 4000000u
+#define ROUND_TRIPS_COUNT 100000u
+
+struct Message {
+	uint32_t sequence;
+	uint8_t payload[MESSAGE_SIZE - sizeof(uint32_t)];
+};
+
+struct RingStorage {
+	alignas(SPSC_RING_ALIGNMENT) uint8_t
+		bytes[SPSC_RING_STORAGE_SIZE(MESSAGE_SIZE, SLOTS_COUNT)];
+};
+
+static struct SpscRing request_ring;
+static struct SpscRing response_ring;
+static struct RingStorage request_storage;
+static struct RingStorage response_storage;
+
+static void push(struct SpscRing *const ring, const struct Message *message)
+{
+	bool is_first;
+	while (!SpscRing_Push(ring, message, sizeof(*message), &is_first)) {
+		sched_yield();
+	}
+}
+
+static uint32_t pop(struct SpscRing *const ring, struct Message *message)
+{
+	const void *data;
+	uint32_t size;
+	while (!SpscRing_Peek(ring, &data, &size)) {
+		sched_yield();
+	}
+	memcpy(message, data, sizeof(*message));
+	SpscRing_Release(ring);
+	return size;
+}
+
+static void *produce(void *arg)
+{
+	(void)arg;
+	struct Message message;
+	memset(&message, 0, sizeof(message));
+	for (uint32_t i = 0u; i < THROUGHPUT_MESSAGES_COUNT; i++) {
+		message.sequence = i;
+		message.payload[sizeof(message.payload) - 1u] = (uint8_t)i;
+		push(&request_ring, &message);
+	}
+	return NULL;
+}
+
+static void benchmark_throughput(void)
+{
+	HOST_TEST_CHECK(SpscRing_Init(&request_ring, request_storage.bytes,
+				      MESSAGE_SIZE, SLOTS_COUNT));
+
+	const uint64_t start = host_test_now_ns();
+	pthread_t producer;
+	HOST_TEST_CHECK(pthread_create(&producer, NULL, produce, NULL) == 0);
+
+	uint32_t failures = 0u;
+	struct Message message;
+	for (uint32_t i = 0u; i < THROUGHPUT_MESSAGES_COUNT; i++) {
+		const uint32_t size = pop(&request_ring, &message);
+		const bool is_intact =
+			size == MESSAGE_SIZE && message.sequence == i &&
+			message.payload[sizeof(message.payload) - 1u] ==
+				(uint8_t)i;
+		failures += is_intact ? 0u : 1u;
+	}
+	HOST_TEST_CHECK(pthread_join(producer, NULL) == 0);
+	const uint64_t elapsed_ns = host_test_now_ns() - start;
+
+	HOST_TEST_CHECK(failures == 0u);
+	printf("throughput: %.1f million messages/s, %.1f ns per message\n",
+	       (double)THROUGHPUT_MESSAGES_COUNT * 1000.0 / (double)elapsed_ns,
+	       (double)elapsed_ns / THROUGHPUT_MESSAGES_COUNT);
+}
+
+static void *echo(void *arg)
+{
+	(void)arg;
+	struct Message message;
+	for (uint32_t i = 0u; i < ROUND_TRIPS_COUNT; i++) {
+		pop(&request_ring, &message);
+		push(&response_ring, &message);
+	}
+	return NULL;
+}
+
+static void benchmark_latency(void)
+{
+	HOST_TEST_CHECK(SpscRing_Init(&request_ring, request_storage.bytes,
+				      MESSAGE_SIZE, SLOTS_COUNT));
+	HOST_TEST_CHECK(SpscRing_Init(&response_ring, response_storage.bytes,
+				      MESSAGE_SIZE, SLOTS_COUNT));
+
+	pthread_t echoing_thread;
+	HOST_TEST_CHECK(pthread_create(&echoing_thread, NULL, echo, NULL) ==
+			0);
+
+	uint32_t failures = 0u;
+	uint64_t total_ns = 0u;
+	uint64_t maximum_ns = 0u;
+	struct Message message;
+	memset(&message, 0, sizeof(message));
+	for (uint32_t i = 0u; i < ROUND_TRIPS_COUNT; i++) {
+		message.sequence = i;
+		const uint64_t start = host_test_now_ns();
+		push(&request_ring, &message);
+		pop(&response_ring, &message);
+		const uint64_t round_trip_ns = host_test_now_ns() - start;
+
+		failures += message.sequence == i ? 0u : 1u;
+		total_ns += round_trip_ns;
+		if (round_trip_ns > maximum_ns) {
+			maximum_ns = round_trip_ns;
+		}
+	}
+	HOST_TEST_CHECK(pthread_join(echoing_thread, NULL) == 0);
+
+	const void *data;
+	uint32_t size;
+	HOST_TEST_CHECK(failures == 0u);
+	HOST_TEST_CHECK(!SpscRing_Peek(&request_ring, &data, &size));
+	HOST_TEST_CHECK(!SpscRing_Peek(&response_ring, &data, &size));
+	printf("round trip: average %.1f ns, maximum %.1f us\n",
+	       (double)total_ns / ROUND_TRIPS_COUNT,
+	       (double)maximum_ns / 1000.0);
+}
+
+int main(void)
+{
+	benchmark_throughput();
+	benchmark_latency();
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TimeConversionTest.c
+ * @brief   Sweeps the fixed-point conversion against the exact ratio and
+ *          against the floating point formula it replaced.
+ */
+
+#include "HostTest.h"
+
+#include <TimeConversion.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+__extension__ typedef unsigned __int128 uint128;
+
+static const uint64_t FREQUENCIES[] = {
+	32768u,	   1500000u,  12000000u,  18750000u,
+	37500000u, 150000000u, 300000000u, 1000000000u,
+	3000000000u, UINT32_MAX,
+};
+
+static uint128 absolute_difference(const uint128 a, const uint128 b)
+{
+	return a > b ? a - b : b - a;
+}
+
+// Checks |result - value * numerator / denominator| < 1 + value / 2^33,
+// results which do not fit in 64 bits are not checked
+static bool is_within_bound(const uint64_t result, const uint64_t value,
+			    const uint64_t numerator,
+			    const uint64_t denominator)
+{
+	if ((uint128)value * numerator / denominator >= ((uint128)1u << 64u)) {
+		return true;
+	}
+
+	const uint128 error = absolute_difference(
+		(uint128)result * denominator, (uint128)value * numerator);
+	const uint128 bound = (uint128)denominator +
+			      (((uint128)value * denominator) >> 33u) + 1u;
+	return error < bound;
+}
+
+// Formula used by Hal_GetElapsedTimeInNs before the fixed-point conversion
+static uint64_t legacy_ticks_to_ns(const uint64_t ticks,
+				   const uint64_t frequency)
+{
+	const double clock_frequency = (double)frequency;
+	return (uint64_t)((double)ticks / (clock_frequency / 1000000000.0));
+}
+
+static void check_value(const struct TimeConversion *const conversion,
+			const uint64_t value, uint64_t *const legacy_deviation)
+{
+	const uint64_t ns = TimeConversion_TicksToNs(conversion, value);
+	HOST_TEST_CHECK(is_within_bound(ns, value,
+					TIME_CONVERSION_NANOSECONDS_IN_SECOND,
+					conversion->frequency));
+
+	const uint64_t ticks = TimeConversion_NsToTicks(conversion, value);
+	HOST_TEST_CHECK(is_within_bound(ticks, value, conversion->frequency,
+					TIME_CONVERSION_NANOSECONDS_IN_SECOND));
+
+	// The double has a 53-bit mantissa, above that the legacy formula
+	// is the less accurate of the two
+	if (value < (1ull << 40u)) {
+		const uint64_t legacy =
+			legacy_ticks_to_ns(value, conversion->frequency);
+		const uint64_t deviation =
+			(uint64_t)absolute_difference(ns, legacy);
+		HOST_TEST_CHECK(deviation <= 2u + (value >> 33u));
+		if (deviation > *legacy_deviation) {
+			*legacy_deviation = deviation;
+		}
+	}
+}
+
+static void sweep_frequency(const uint64_t frequency)
+{
+	struct TimeConversion conversion;
+	HOST_TEST_CHECK(TimeConversion_Init(&conversion, frequency));
+
+	uint64_t legacy_deviation = 0u;
+
+	// Dense sweep of small values, where rounding matters most
+	for (uint64_t value = 0u; value < 200000u; value++) {
+		check_value(&conversion, value, &legacy_deviation);
+	}
+
+	// Geometric sweep up to 2^63 with neighbours of each point
+	for (uint32_t shift = 17u; shift < 64u; shift++) {
+		const uint64_t base = 1ull << shift;
+		for (uint64_t offset = 0u; offset < 64u; offset++) {
+			check_value(&conversion, base - offset - 1u,
+				    &legacy_deviation);
+			check_value(&conversion, base + offset,
+				    &legacy_deviation);
+		}
+	}
+
+	// Random values within 2^48 ticks, the range of the chained timebase
+	uint64_t state = frequency | 1u;
+	for (uint32_t i = 0u; i < 1000000u; i++) {
+		const uint64_t value =
+			host_test_random(&state) & ((1ull << 48u) - 1u);
+		check_value(&conversion, value, &legacy_deviation);
+	}
+
+	printf("%10llu Hz: maximum deviation from the double formula %llu ns\n",
+	       (unsigned long long)frequency,
+	       (unsigned long long)legacy_deviation);
+}
+
+static void test_rejects_invalid_frequency(void)
+{
+	struct TimeConversion conversion;
+	HOST_TEST_CHECK(!TimeConversion_Init(&conversion, 0u));
+	HOST_TEST_CHECK(
+		!TimeConversion_Init(&conversion, (uint64_t)UINT32_MAX + 1u));
+}
+
+static void test_exact_ratios(void)
+{
+	// Ratios with no fractional part are converted exactly
+	struct TimeConversion conversion;
+	HOST_TEST_CHECK(TimeConversion_Init(&conversion, 1000000u));
+	HOST_TEST_CHECK(TimeConversion_TicksToNs(&conversion, 123456789u) ==
+			123456789000u);
+	HOST_TEST_CHECK(TimeConversion_Init(&conversion, 1000000000u));
+	HOST_TEST_CHECK(TimeConversion_NsToTicks(&conversion, 123456789000u) ==
+			123456789000u);
+}
+
+int main(void)
+{
+	test_rejects_invalid_frequency();
+	test_exact_ratios();
+	for (size_t i = 0u; i < sizeof(FREQUENCIES) / sizeof(FREQUENCIES[0]);
+	     i++) {
+		sweep_frequency(FREQUENCIES[i]);
+	}
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,193 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TimebaseLatchStressTest.c
+ * @brief   Stresses the extension of the 16-bit timebase counter with a
+ *          simulated overflow interrupt, delivered both between the reads
+ *          of a reader and from a concurrent thread.
+ */
+
+#include "HostTest.h"
+
+#include <TimebaseLatch.h>
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HALF_RANGE 0x8000u
+#define MAXIMUM_INTERRUPT_LATENCY 0x4000u
+#define INTERRUPTED_READS_COUNT 2000000u
+#define WRITER_STEPS_COUNT 20000000u
+#define MAXIMUM_WRITER_STEP 0x3FFFu
+#define READERS_COUNT 3u
+
+static struct TimebaseLatch latch;
+static uint64_t random_state = 7u;
+
+// Simulated hardware used by test_interrupted_reads
+static uint64_t hardware_ticks;
+static uint64_t next_boundary;
+static uint64_t next_interrupt_ticks;
+static uint64_t interrupts_count;
+
+static void schedule_interrupt(void)
+{
+	next_boundary += HALF_RANGE;
+	next_interrupt_ticks =
+		next_boundary +
+		host_test_random(&random_state) % MAXIMUM_INTERRUPT_LATENCY;
+}
+
+// The time passing before the counter is sampled models the reader being
+// preempted, all interrupts which became due in the meantime are handled
+// before the sample, as they would preempt the reader
+static uint32_t read_interrupted_counter(void)
+{
+	const uint64_t random = host_test_random(&random_state);
+	const uint64_t step = random % 4u == 0u
+				      ? (random >> 8u) % (4u * 0x10000u)
+				      : (random >> 8u) % 0x100u;
+	const uint64_t end_ticks = hardware_ticks + step;
+
+	while (next_interrupt_ticks <= end_ticks) {
+		interrupts_count++;
+		TimebaseLatch_Update(&latch, (uint32_t)next_interrupt_ticks &
+						     TIMEBASE_LATCH_CHANNEL_MASK);
+		schedule_interrupt();
+	}
+	hardware_ticks = end_ticks;
+	return (uint32_t)hardware_ticks & TIMEBASE_LATCH_CHANNEL_MASK;
+}
+
+static void test_interrupted_reads(void)
+{
+	TimebaseLatch_Init(&latch);
+	hardware_ticks = 0u;
+	next_boundary = 0u;
+	schedule_interrupt();
+
+	uint64_t previous = 0u;
+	uint32_t failures = 0u;
+	for (uint32_t i = 0u; i < INTERRUPTED_READS_COUNT; i++) {
+		const uint64_t ticks =
+			TimebaseLatch_Read(&latch, read_interrupted_counter);
+		// The value shall be the time of the last counter sample
+		if (ticks != hardware_ticks || ticks < previous) {
+			failures++;
+		}
+		previous = ticks;
+	}
+
+	HOST_TEST_CHECK(failures == 0u);
+	printf("Interrupted reads: %u failures, %llu interrupts, %llu ticks\n",
+	       failures, (unsigned long long)interrupts_count,
+	       (unsigned long long)hardware_ticks);
+}
+
+// Shared state used by test_concurrent_reads
+static uint64_t shared_ticks;
+static bool is_writer_done;
+static uint32_t concurrent_failures;
+
+static uint32_t read_shared_counter(void)
+{
+	return (uint32_t)__atomic_load_n(&shared_ticks, __ATOMIC_ACQUIRE) &
+	       TIMEBASE_LATCH_CHANNEL_MASK;
+}
+
+// Advances the counter and runs the overflow interrupt handler on every
+// crossing of the overflow and the middle of the range, as the hardware
+static void *run_writer(void *arg)
+{
+	(void)arg;
+	uint64_t state = 11u;
+	uint64_t ticks = 0u;
+	for (uint32_t i = 0u; i < WRITER_STEPS_COUNT; i++) {
+		const uint64_t next_ticks =
+			ticks + 1u + host_test_random(&state) % MAXIMUM_WRITER_STEP;
+		__atomic_store_n(&shared_ticks, next_ticks, __ATOMIC_RELEASE);
+		if (next_ticks / HALF_RANGE != ticks / HALF_RANGE) {
+			TimebaseLatch_Update(&latch,
+					     (uint32_t)next_ticks &
+						     TIMEBASE_LATCH_CHANNEL_MASK);
+		}
+		ticks = next_ticks;
+	}
+	__atomic_store_n(&is_writer_done, true, __ATOMIC_RELEASE);
+	return NULL;
+}
+
+static void *run_reader(void *arg)
+{
+	uint64_t *const reads_count = (uint64_t *)arg;
+	uint64_t previous = 0u;
+	while (!__atomic_load_n(&is_writer_done, __ATOMIC_ACQUIRE)) {
+		const uint64_t before =
+			__atomic_load_n(&shared_ticks, __ATOMIC_ACQUIRE);
+		const uint64_t ticks =
+			TimebaseLatch_Read(&latch, read_shared_counter);
+		const uint64_t after =
+			__atomic_load_n(&shared_ticks, __ATOMIC_ACQUIRE);
+		if (ticks < before || ticks > after || ticks < previous) {
+			__atomic_fetch_add(&concurrent_failures, 1u,
+					   __ATOMIC_RELAXED);
+		}
+		previous = ticks;
+		(*reads_count)++;
+	}
+	return NULL;
+}
+
+static void test_concurrent_reads(void)
+{
+	TimebaseLatch_Init(&latch);
+	shared_ticks = 0u;
+	is_writer_done = false;
+	concurrent_failures = 0u;
+
+	pthread_t writer;
+	pthread_t readers[READERS_COUNT];
+	uint64_t reads_counts[READERS_COUNT] = { 0u };
+	for (uint32_t i = 0u; i < READERS_COUNT; i++) {
+		HOST_TEST_CHECK(pthread_create(&readers[i], NULL, run_reader,
+					       &reads_counts[i]) == 0);
+	}
+	HOST_TEST_CHECK(pthread_create(&writer, NULL, run_writer, NULL) == 0);
+	HOST_TEST_CHECK(pthread_join(writer, NULL) == 0);
+
+	uint64_t reads_count = 0u;
+	for (uint32_t i = 0u; i < READERS_COUNT; i++) {
+		HOST_TEST_CHECK(pthread_join(readers[i], NULL) == 0);
+		reads_count += reads_counts[i];
+	}
+
+	HOST_TEST_CHECK(concurrent_failures == 0u);
+	printf("Concurrent reads: %u failures, %llu reads\n",
+	       concurrent_failures, (unsigned long long)reads_count);
+}
+
+int main(void)
+{
+	test_interrupted_reads();
+	test_concurrent_reads();
+
+	return HOST_TEST_RESULT();
+}
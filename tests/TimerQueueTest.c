@@ -0,0 +1,269 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TimerQueueTest.c
+ * @brief   Drives the deadline queue with a simulated comparator, arming
+ *          it the same way as Hal, and checks that every timer expires
+ *          exactly at its deadline, once.
+ */
+
+#include "HostTest.h"
+
+#include <TimerQueue.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TIMERS_COUNT 64u
+#define OPERATIONS_COUNT 2000000u
+#define COMPARATOR_MAX_TICKS 0xFFFFu
+#define COMPARATOR_COARSE_CLOCK_RATIO 16u
+#define NO_COMPARE UINT64_MAX
+
+struct SimulatedTimer {
+	struct TimerQueue_Entry entry;
+	uint64_t deadline;
+	bool is_armed;
+};
+
+struct Simulation {
+	struct TimerQueue queue;
+	struct SimulatedTimer timers[TIMERS_COUNT];
+	uint64_t now;
+	uint64_t compare_time;
+	uint64_t random_state;
+	uint64_t expected_expirations_count;
+	uint64_t expirations_count;
+	uint64_t stale_expirations_count;
+	uint64_t comparator_interrupts_count;
+};
+
+static struct Simulation simulation;
+
+// Same ranges as comparator_arm in Hal.c: deadlines beyond the 16-bit
+// range use a 16 times slower clock and fire early
+static void comparator_arm(const uint64_t deadline)
+{
+	const uint64_t now = simulation.now;
+	const uint64_t delta = deadline > now ? deadline - now : 0u;
+
+	if (delta == 0u) {
+		simulation.compare_time = now + 1u;
+	} else if (delta <= COMPARATOR_MAX_TICKS) {
+		simulation.compare_time = now + delta;
+	} else if (delta / COMPARATOR_COARSE_CLOCK_RATIO <=
+		   COMPARATOR_MAX_TICKS) {
+		simulation.compare_time =
+			now + delta / COMPARATOR_COARSE_CLOCK_RATIO *
+				      COMPARATOR_COARSE_CLOCK_RATIO;
+	} else {
+		simulation.compare_time =
+			now + (uint64_t)COMPARATOR_MAX_TICKS *
+				      COMPARATOR_COARSE_CLOCK_RATIO;
+	}
+}
+
+static void arm_timer(struct SimulatedTimer *const timer,
+		      const uint64_t deadline)
+{
+	if (timer->is_armed) {
+		// Superseded arming never expires
+		simulation.expected_expirations_count--;
+	}
+	timer->is_armed = true;
+	timer->deadline = deadline;
+	simulation.expected_expirations_count++;
+	if (TimerQueue_Insert(&simulation.queue, &timer->entry, deadline)) {
+		comparator_arm(deadline);
+	}
+}
+
+static void cancel_timer(struct SimulatedTimer *const timer)
+{
+	if (timer->is_armed) {
+		simulation.expected_expirations_count--;
+	}
+	timer->is_armed = false;
+	TimerQueue_Remove(&simulation.queue, &timer->entry);
+}
+
+// Same checks as expire_timer in Hal.c
+static void expire_timer(void *arg, uint32_t generation)
+{
+	struct SimulatedTimer *const timer = (struct SimulatedTimer *)arg;
+	if (!timer->is_armed || timer->entry.generation != generation) {
+		simulation.stale_expirations_count++;
+		return;
+	}
+
+	timer->is_armed = false;
+	simulation.expirations_count++;
+	HOST_TEST_CHECK(simulation.now == timer->deadline);
+}
+
+static uint64_t random_deadline(void)
+{
+	// Mostly short deadlines, sometimes beyond both comparator ranges
+	const uint64_t random = host_test_random(&simulation.random_state);
+	const uint32_t range_bits = 8u + (uint32_t)(random % 16u);
+	return simulation.now + 1u + ((random >> 8u) & ((1ull << range_bits) - 1u));
+}
+
+// Same sequence as service_timer_queue in Hal.c
+static void comparator_interrupt(void)
+{
+	simulation.comparator_interrupts_count++;
+	simulation.compare_time = NO_COMPARE;
+
+	while (true) {
+		struct TimerQueue_Entry *const entry =
+			TimerQueue_PopExpired(&simulation.queue, simulation.now);
+		if (entry == NULL) {
+			break;
+		}
+		const uint32_t generation = entry->generation;
+
+		// An interrupt of higher priority restarts the timer between
+		// the removal of the entry and the callback
+		const uint64_t random =
+			host_test_random(&simulation.random_state);
+		if (random % 8u == 0u) {
+			struct SimulatedTimer *const timer =
+				(struct SimulatedTimer *)entry->arg;
+			arm_timer(timer, random_deadline());
+		} else if (random % 8u == 1u) {
+			cancel_timer((struct SimulatedTimer *)entry->arg);
+		}
+
+		entry->callback(entry->arg, generation);
+	}
+
+	const struct TimerQueue_Entry *const head =
+		TimerQueue_Peek(&simulation.queue);
+	if (head != NULL) {
+		comparator_arm(head->deadline);
+	}
+}
+
+// Advances the time to the given one, servicing the comparator on the way
+static void run_until(const uint64_t time)
+{
+	while (simulation.compare_time <= time) {
+		simulation.now = simulation.compare_time;
+		comparator_interrupt();
+	}
+	simulation.now = time;
+}
+
+static void test_random_operations(void)
+{
+	TimerQueue_Init(&simulation.queue);
+	for (uint32_t i = 0u; i < TIMERS_COUNT; i++) {
+		TimerQueue_InitEntry(&simulation.timers[i].entry, expire_timer,
+				     &simulation.timers[i]);
+		simulation.timers[i].is_armed = false;
+	}
+	simulation.now = 0u;
+	simulation.compare_time = NO_COMPARE;
+	simulation.random_state = 42u;
+
+	for (uint32_t i = 0u; i < OPERATIONS_COUNT; i++) {
+		const uint64_t random =
+			host_test_random(&simulation.random_state);
+		run_until(simulation.now + random % 4096u);
+
+		struct SimulatedTimer *const timer =
+			&simulation.timers[(random >> 16u) % TIMERS_COUNT];
+		if ((random >> 32u) % 4u == 0u) {
+			cancel_timer(timer);
+		} else {
+			arm_timer(timer, random_deadline());
+		}
+	}
+
+	// Drain the queue
+	while (simulation.compare_time != NO_COMPARE) {
+		run_until(simulation.compare_time);
+	}
+
+	HOST_TEST_CHECK(TimerQueue_Peek(&simulation.queue) == NULL);
+	HOST_TEST_CHECK(simulation.expirations_count ==
+			simulation.expected_expirations_count);
+	HOST_TEST_CHECK(simulation.stale_expirations_count > 0u);
+	printf("%llu expirations, %llu stale, %llu comparator interrupts\n",
+	       (unsigned long long)simulation.expirations_count,
+	       (unsigned long long)simulation.stale_expirations_count,
+	       (unsigned long long)simulation.comparator_interrupts_count);
+}
+
+static uint32_t order_index;
+static uint32_t expiration_order[4];
+
+static void record_order(void *arg, uint32_t generation)
+{
+	(void)generation;
+	expiration_order[order_index++] = (uint32_t)(uintptr_t)arg;
+}
+
+static void test_equal_deadlines_keep_insertion_order(void)
+{
+	struct TimerQueue queue;
+	struct TimerQueue_Entry entries[4];
+	TimerQueue_Init(&queue);
+	for (uint32_t i = 0u; i < 4u; i++) {
+		TimerQueue_InitEntry(&entries[i], record_order,
+				     (void *)(uintptr_t)i);
+	}
+
+	HOST_TEST_CHECK(TimerQueue_Insert(&queue, &entries[2], 10u));
+	HOST_TEST_CHECK(!TimerQueue_Insert(&queue, &entries[0], 10u));
+	HOST_TEST_CHECK(TimerQueue_Insert(&queue, &entries[3], 5u));
+	HOST_TEST_CHECK(!TimerQueue_Insert(&queue, &entries[1], 10u));
+	HOST_TEST_CHECK(TimerQueue_PopExpired(&queue, 4u) == NULL);
+
+	order_index = 0u;
+	struct TimerQueue_Entry *entry;
+	while ((entry = TimerQueue_PopExpired(&queue, 10u)) != NULL) {
+		entry->callback(entry->arg, entry->generation);
+	}
+	HOST_TEST_CHECK(order_index == 4u);
+	HOST_TEST_CHECK(expiration_order[0] == 3u);
+	HOST_TEST_CHECK(expiration_order[1] == 2u);
+	HOST_TEST_CHECK(expiration_order[2] == 0u);
+	HOST_TEST_CHECK(expiration_order[3] == 1u);
+
+	// Generation changes on every insertion, also of a queued entry
+	const uint32_t generation = entries[0].generation;
+	TimerQueue_Insert(&queue, &entries[0], 20u);
+	TimerQueue_Insert(&queue, &entries[0], 30u);
+	HOST_TEST_CHECK(entries[0].generation == generation + 2u);
+	HOST_TEST_CHECK(TimerQueue_Remove(&queue, &entries[0]));
+	HOST_TEST_CHECK(!TimerQueue_Remove(&queue, &entries[0]));
+	HOST_TEST_CHECK(TimerQueue_Peek(&queue) == NULL);
+}
+
+int main(void)
+{
+	test_equal_deadlines_keep_insertion_order();
+	test_random_operations();
+
+	return HOST_TEST_RESULT();
+}
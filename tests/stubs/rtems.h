@@ -0,0 +1,40 @@
+/**@file
+ * This file is part of the TASTE SAMV71 RTEMS Runtime.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOST_STUB_RTEMS_H
+#define HOST_STUB_RTEMS_H
+
+/**
+ * @file    rtems.h
+ * @brief   Host replacement of the part of the RTEMS API used by the
+ *          modules under test.
+ *
+ * Only the local interrupt masking is provided. The modules use it to
+ * protect against interrupts on a single core, the host tests using them
+ * access each instance from one thread, so it does nothing.
+ */
+
+#include <stdint.h>
+
+typedef uint32_t rtems_interrupt_level;
+
+#define rtems_interrupt_local_disable(level) ((level) = 0u)
+#define rtems_interrupt_local_enable(level) ((void)(level))
+
+#endif